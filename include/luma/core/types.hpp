@@ -93,6 +93,7 @@ enum class ErrorCode : u32 {
     SCENE_UNKNOWN = 3000,
     SCENE_INVALID_SCENE_FILE = 3001,
     SCENE_MISSING_REQUIRED_FIELD = 3002,
+    SCENE_COMPONENT_NOT_COPYABLE = 3003,
     
     // Asset module errors (4000-4999)
     ASSET_UNKNOWN = 4000,
@@ -6,15 +6,22 @@
  * with the same component signature belong to the same archetype, enabling
  * cache-friendly iteration.
  * 
- * **Storage Strategy**: Structure of Arrays (SoA)
- * - Each component type has its own contiguous array
- * - Better cache locality than Array of Structures (AoS)
- * - Enables SIMD operations (future optimization)
+ * **Storage Strategy**: Chunked Structure of Arrays (SoA)
+ * - Entities live in fixed-size 16 KiB chunks (CHUNK_SIZE)
+ * - Each chunk holds N entities and ALL their components, one SoA block per type
+ * - Chunk capacity N is computed once per archetype from its component sizes
+ * - Growth allocates one more chunk (no whole-column reallocation or copying)
+ * - A chunk is the natural unit of work for iteration and parallel jobs
+ * 
+ * Chunk memory layout (N = capacity):
+ * @code
+ * [ Entity x N | pad | ComponentA x N | pad | ComponentB x N | ... ]
+ * @endcode
  * 
  * ✨ FUNCTIONAL DESIGN ✨
- * - Archetype is immutable once created (signature fixed)
- * - Entity additions append to arrays (grow-only, no reallocation mid-frame)
- * - Entity removals swap-and-pop (maintains contiguous storage)
+ * - Archetype is immutable once created (signature and chunk layout fixed)
+ * - Entity additions fill the last chunk, then append a new one
+ * - Entity removals swap-and-pop (maintains densely packed chunks)
  * 
  * @author LukeFrankio
  * @date 2025-10-08
@@ -26,127 +33,389 @@
 #include <luma/scene/component.hpp>
 #include <luma/scene/entity.hpp>
 
-#include <any>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <memory>
-#include <unordered_map>
+#include <new>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace luma::scene {
 
 /**
- * @brief Type-erased component array
+ * @brief Size of one archetype chunk in bytes (16 KiB)
  * 
- * Stores components of a single type in contiguous memory.
- * Uses std::any for type erasure (enables generic archetype storage).
+ * Small enough to stay L1/L2 resident while a system walks it, large enough
+ * to amortize per-chunk overhead. Archetypes whose single row exceeds this
+ * size fall back to one-entity chunks of the required size.
+ */
+inline constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+
+/**
+ * @brief Alignment of chunk allocations (cache line)
+ */
+inline constexpr std::size_t CHUNK_ALIGNMENT = 64;
+
+/**
+ * @brief Sentinel archetype index ("no archetype" / edge not cached yet)
+ */
+constexpr u32 INVALID_ARCHETYPE = static_cast<u32>(-1);
+
+/**
+ * @brief Per-type operations table for type-erased component storage
  * 
- * ⚠️ IMPURE CLASS (manages mutable storage)
+ * Captures everything needed to manage a component column without knowing
+ * its static type: layout (size, alignment) and lifetime operations (move,
+ * copy, destroy, relocate). One table exists per component type.
+ * 
+ * ✨ IMMUTABLE VALUE TYPE ✨
+ * 
+ * @note Built at compile time via ComponentTypeInfo::of<T>()
  */
-class ComponentArray {
-public:
+struct ComponentTypeInfo {
+    u32 size{0};  ///< sizeof(T)
+    u32 alignment{1};  ///< alignof(T)
+    bool trivially_relocatable{false};  ///< Relocation is a plain memcpy (trivially copyable T)
+    StoragePolicy storage{StoragePolicy::TABLE};  ///< Archetype column or sparse set
+    void (*default_construct)(void* dst){nullptr};  ///< Placement-new T() at dst (nullptr if T has no default constructor)
+    void (*move_construct)(void* dst, void* src){nullptr};  ///< Placement-new T(std::move(*src)) at dst
+    void (*copy_construct)(void* dst, const void* src){nullptr};  ///< Placement-new T(*src) at dst (nullptr if T is move-only)
+    void (*destroy)(void* ptr){nullptr};  ///< Call ~T() on ptr
+    void (*relocate)(void* dst, void* src){nullptr};  ///< Move src into dst, then destroy src
+    
     /**
-     * @brief Construct empty component array
+     * @brief Relocate one component from src to (uninitialized) dst
      * 
-     * @tparam T Component type
+     * ⚠️ IMPURE (ends the lifetime of *src)
+     * 
+     * Trivially relocatable types are a single memcpy; everything else goes
+     * through move-construct + destroy (e.g. std::string steals its buffer,
+     * no allocation).
+     * 
+     * @param dst Uninitialized destination slot
+     * @param src Live source slot (dead afterwards)
      */
-    template<typename T>
-    static auto create() -> std::unique_ptr<ComponentArray> {
-        auto array = std::make_unique<ComponentArray>();
-        array->data_ = std::vector<T>();
-        return array;
+    auto relocate_to(void* dst, void* src) const -> void {
+        if (trivially_relocatable) {
+            std::memcpy(dst, src, size);
+        } else {
+            relocate(dst, src);
+        }
     }
     
     /**
-     * @brief Add component to array
+     * @brief Build operations table for component type T
      * 
-     * ⚠️ IMPURE (appends to vector)
+     * ✨ PURE FUNCTION ✨
      * 
-     * @tparam T Component type
-     * @param component Component data
+     * @tparam T Component type (must be move-constructible)
+     * @return Operations table for T
      */
     template<typename T>
-    auto push(T component) -> void {
-        std::any_cast<std::vector<T>&>(data_).push_back(std::move(component));
+    [[nodiscard]] static constexpr auto of() noexcept -> ComponentTypeInfo {
+        static_assert(std::is_move_constructible_v<T>, "Components must be move-constructible");
+        static_assert(ComponentStorage<T>::value != StoragePolicy::TAG || std::is_empty_v<T>,
+                      "Tag components must be empty types (a specialized ComponentStorage too)");
+        return ComponentTypeInfo{
+            .size = static_cast<u32>(sizeof(T)),
+            .alignment = static_cast<u32>(alignof(T)),
+            .trivially_relocatable = std::is_trivially_copyable_v<T>,
+            .storage = ComponentStorage<T>::value,
+            .default_construct = []() -> void (*)(void*) {
+                if constexpr (std::is_default_constructible_v<T>) {
+                    return [](void* dst) {
+                        ::new (dst) T();
+                    };
+                } else {
+                    return nullptr;
+                }
+            }(),
+            .move_construct = [](void* dst, void* src) {
+                ::new (dst) T(std::move(*static_cast<T*>(src)));
+            },
+            .copy_construct = []() -> void (*)(void*, const void*) {
+                if constexpr (std::is_copy_constructible_v<T>) {
+                    return [](void* dst, const void* src) {
+                        ::new (dst) T(*static_cast<const T*>(src));
+                    };
+                } else {
+                    return nullptr;  // Move-only component (snapshots refuse it)
+                }
+            }(),
+            .destroy = [](void* ptr) {
+                static_cast<T*>(ptr)->~T();
+            },
+            .relocate = [](void* dst, void* src) {
+                T* source = static_cast<T*>(src);
+                ::new (dst) T(std::move(*source));
+                source->~T();
+            },
+        };
+    }
+};
+
+/**
+ * @brief Description of one component column in an archetype
+ * 
+ * ✨ IMMUTABLE VALUE TYPE ✨
+ */
+struct ArchetypeColumn {
+    u32 type_id{0};  ///< Component type ID
+    ComponentTypeInfo info;  ///< Operations table for the component type
+    u32 offset{0};  ///< Byte offset of this column's SoA block inside a chunk
+};
+
+class Archetype;
+
+/**
+ * @brief Fixed-size block holding N entities and all of their components
+ * 
+ * A chunk is owned by exactly one archetype and uses that archetype's layout.
+ * Rows [0, size()) are live; the entity list and every component column are
+ * contiguous arrays inside the chunk, so a system touching a chunk streams
+ * through at most CHUNK_SIZE bytes.
+ * 
+ * ⚠️ IMPURE CLASS (manages mutable storage)
+ * 
+ * @note Chunks are created by Archetype, never directly by users
+ * @note Chunk does not destroy components itself; Archetype manages lifetimes
+ */
+class Chunk {
+public:
+    /**
+     * @brief Allocate an empty chunk using an archetype's layout
+     * 
+     * @param owner Archetype whose layout this chunk uses
+     */
+    explicit Chunk(const Archetype& owner);
+    
+    /**
+     * @brief Destructor (frees the chunk block)
+     * 
+     * ⚠️ IMPURE (deallocates memory)
+     */
+    ~Chunk();
+    
+    // Non-copyable, non-movable (column pointers are handed out to systems)
+    Chunk(const Chunk&) = delete;
+    Chunk& operator=(const Chunk&) = delete;
+    Chunk(Chunk&&) = delete;
+    Chunk& operator=(Chunk&&) = delete;
+    
+    /**
+     * @brief Get number of live entities in this chunk
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Row count
+     */
+    [[nodiscard]] auto size() const -> u32 {
+        return count_;
     }
     
     /**
-     * @brief Remove component at index (swap-and-pop)
+     * @brief Get maximum number of entities this chunk can hold
      * 
-     * ⚠️ IMPURE (modifies vector)
+     * ✨ PURE FUNCTION ✨
      * 
-     * Swaps element at index with last element, then pops last.
-     * This maintains contiguous storage but changes element order.
+     * @return Row capacity
+     */
+    [[nodiscard]] auto capacity() const -> u32;
+    
+    /**
+     * @brief View entity list of this chunk
      * 
-     * @tparam T Component type
-     * @param index Index to remove
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Span over live entities (index i matches column row i)
      */
-    template<typename T>
-    auto remove(u32 index) -> void {
-        auto& vec = std::any_cast<std::vector<T>&>(data_);
-        if (index < vec.size() - 1) {
-            vec[index] = std::move(vec.back());
-        }
-        vec.pop_back();
+    [[nodiscard]] auto entities() const -> std::span<const Entity> {
+        return {std::launder(reinterpret_cast<const Entity*>(data_)), count_};
     }
     
     /**
-     * @brief Get component at index (read-only)
+     * @brief Get raw pointer to the start of a component column
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID
+     * @return Column base pointer (nullptr if archetype lacks the component)
+     */
+    [[nodiscard]] auto column_raw(u32 type_id) const -> std::byte*;
+    
+    /**
+     * @brief View a component column as a typed span (read-only)
      * 
      * ✨ PURE FUNCTION ✨
      * 
      * @tparam T Component type
-     * @param index Index in array
-     * @return Pointer to component (nullptr if out of bounds)
+     * @param type_id Component type ID
+     * @return Span over live rows (empty if archetype lacks the component)
      */
     template<typename T>
-    [[nodiscard]] auto get(u32 index) const -> const T* {
-        const auto& vec = std::any_cast<const std::vector<T>&>(data_);
-        return index < vec.size() ? &vec[index] : nullptr;
+    [[nodiscard]] auto column(u32 type_id) const -> std::span<const T> {
+        auto* base = column_raw(type_id);
+        return base ? std::span<const T>{std::launder(reinterpret_cast<const T*>(base)), count_}
+                    : std::span<const T>{};
     }
     
     /**
-     * @brief Get component at index (mutable)
+     * @brief View a component column as a typed span (mutable)
      * 
      * ⚠️ IMPURE (allows mutation)
      * 
      * @tparam T Component type
-     * @param index Index in array
-     * @return Pointer to component (nullptr if out of bounds)
+     * @param type_id Component type ID
+     * @return Span over live rows (empty if archetype lacks the component)
      */
     template<typename T>
-    [[nodiscard]] auto get(u32 index) -> T* {
-        auto& vec = std::any_cast<std::vector<T>&>(data_);
-        return index < vec.size() ? &vec[index] : nullptr;
+    [[nodiscard]] auto column(u32 type_id) -> std::span<T> {
+        auto* base = column_raw(type_id);
+        return base ? std::span<T>{std::launder(reinterpret_cast<T*>(base)), count_}
+                    : std::span<T>{};
     }
     
     /**
-     * @brief Get number of components in array
+     * @brief Get latest change tick of any row in a column
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * @tparam T Component type
-     * @return Component count
+     * Lets change queries skip whole chunks without looking at rows.
+     * 
+     * @param type_id Component type ID
+     * @return Tick of most recent write (0 if never written or column absent)
      */
-    template<typename T>
-    [[nodiscard]] auto size() const -> std::size_t {
-        return std::any_cast<const std::vector<T>&>(data_).size();
+    [[nodiscard]] auto changed_tick(u32 type_id) const -> u32 {
+        const auto* block = tick_block(type_id);
+        return block ? block[CHANGED_TICK] : 0;
+    }
+    
+    /**
+     * @brief Get change tick of one component
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID
+     * @param row Row inside chunk (< size())
+     * @return Tick of most recent write to this row's component (0 if absent)
+     */
+    [[nodiscard]] auto row_tick(u32 type_id, u32 row) const -> u32 {
+        const auto* block = tick_block(type_id);
+        return block ? std::max(block[BULK_TICK], block[FIRST_ROW_TICK + row]) : 0;
+    }
+    
+    /**
+     * @brief Record a write to every row of a column
+     * 
+     * ⚠️ IMPURE (updates change ticks)
+     * 
+     * O(1): stored as one column-wide tick rather than per row. Used when a
+     * mutable span over the whole column is handed out.
+     * 
+     * @param type_id Component type ID
+     * @param tick Current world change tick
+     */
+    auto mark_column_changed(u32 type_id, u32 tick) -> void {
+        if (auto* block = tick_block(type_id)) {
+            block[BULK_TICK] = tick;
+            block[CHANGED_TICK] = std::max(block[CHANGED_TICK], tick);
+        }
+    }
+    
+    /**
+     * @brief Record a write to one component
+     * 
+     * ⚠️ IMPURE (updates change ticks)
+     * 
+     * The column-wide hint is only written when it grows, so once it holds
+     * the current tick (raise_changed_tick()) distinct rows can be stamped
+     * from several threads.
+     * 
+     * @param type_id Component type ID
+     * @param row Row inside chunk (< size())
+     * @param tick Tick to record
+     */
+    auto mark_row_changed(u32 type_id, u32 row, u32 tick) -> void {
+        if (auto* block = tick_block(type_id)) {
+            block[FIRST_ROW_TICK + row] = tick;
+            if (block[CHANGED_TICK] < tick) {
+                block[CHANGED_TICK] = tick;
+            }
+        }
+    }
+    
+    /**
+     * @brief Raise the column's latest-write hint without touching any row
+     * 
+     * ⚠️ IMPURE (updates change ticks)
+     * 
+     * Change queries then look at this chunk's row ticks, which stay exact.
+     * 
+     * @param type_id Component type ID
+     * @param tick Tick to record
+     */
+    auto raise_changed_tick(u32 type_id, u32 tick) -> void {
+        if (auto* block = tick_block(type_id)) {
+            block[CHANGED_TICK] = std::max(block[CHANGED_TICK], tick);
+        }
     }
 
 private:
-    std::any data_;  ///< Type-erased component vector
+    friend class Archetype;
+    
+    // Per-column tick block layout: [changed, bulk, row 0, row 1, ..., row N-1]
+    static constexpr u32 CHANGED_TICK = 0;  ///< Max tick of any write in the column
+    static constexpr u32 BULK_TICK = 1;  ///< Tick of last whole-column write
+    static constexpr u32 FIRST_ROW_TICK = 2;  ///< Per-row ticks start here
+    
+    /**
+     * @brief Get tick block of a column (nullptr if archetype lacks it)
+     */
+    [[nodiscard]] auto tick_block(u32 type_id) const -> u32*;
+    
+    /**
+     * @brief Get tick block by column slot
+     */
+    [[nodiscard]] auto tick_block_at(std::size_t slot) const -> u32*;
+    
+    /**
+     * @brief Fold column-wide write ticks into the live rows
+     * 
+     * ⚠️ IMPURE (writes tick blocks)
+     * 
+     * Afterwards every row tick is exact on its own, so rows can be
+     * exchanged with another chunk without inheriting its column writes.
+     */
+    auto fold_bulk_ticks() -> void;
+    
+    const Archetype* owner_;  ///< Archetype providing the layout
+    std::byte* data_{nullptr};  ///< Chunk block (CHUNK_ALIGNMENT aligned)
+    std::unique_ptr<u32[]> ticks_;  ///< Change ticks, one block per column (kept outside the hot data)
+    u32 count_{0};  ///< Number of live rows
 };
 
 /**
  * @brief Archetype - stores entities with identical component signatures
  * 
  * Each archetype has:
- * - **Entity list**: All entities in this archetype
- * - **Component arrays**: One per component type (SoA layout)
+ * - **Chunks**: Fixed-size blocks, each holding entities + components (SoA)
+ * - **Column layout**: Offset of every component array inside a chunk
  * - **Signature**: Bitset identifying which components this archetype has
+ *   (tag components contribute a bit but no column)
+ * 
+ * Entities are addressed by a flat row index; row i lives in
+ * chunk i / chunk_capacity() at slot i % chunk_capacity().
+ * 
+ * **Archetype Graph**: each archetype caches edges to its neighbours
+ * ("add component X -> archetype Y", "remove X -> Z"), so structural
+ * transitions after the first one are a single array lookup (no hashing).
  * 
  * **Performance Characteristics**:
- * - Add entity: O(1) amortized (vector push_back)
- * - Remove entity: O(1) (swap-and-pop)
- * - Query components: O(n) iteration over contiguous arrays (cache-friendly)
+ * - Add entity: O(1) (fills last chunk, allocates one chunk when full)
+ * - Remove entity: O(1) (swap-and-pop from last row)
+ * - Query components: O(n) iteration chunk by chunk (cache-friendly)
  * 
  * ⚠️ IMPURE CLASS (manages mutable storage)
  * 
@@ -155,16 +424,35 @@ private:
 class Archetype {
 public:
     /**
-     * @brief Construct archetype with component signature
+     * @brief Construct archetype with component signature and columns
+     * 
+     * Computes the chunk layout (capacity and column offsets) once.
      * 
      * @param signature Component signature bitset
+     * @param columns Component columns (offsets are computed here)
+     */
+    Archetype(ComponentSignature signature, std::vector<ArchetypeColumn> columns);
+    
+    /**
+     * @brief Destructor (destroys all live components, frees chunks)
+     * 
+     * ⚠️ IMPURE (deallocates memory)
      */
-    explicit Archetype(ComponentSignature signature);
+    ~Archetype();
+    
+    // Non-copyable, non-movable (chunks point back at their archetype)
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+    Archetype(Archetype&&) = delete;
+    Archetype& operator=(Archetype&&) = delete;
     
     /**
      * @brief Add entity to archetype
      * 
-     * ⚠️ IMPURE (modifies entities_ vector)
+     * ⚠️ IMPURE (may allocate a chunk)
+     * 
+     * The component slots of the new row are left uninitialized; the caller
+     * must construct every column (construct_component / component_raw).
      * 
      * @param entity Entity to add
      * @return Index of entity in archetype (used for component lookup)
@@ -174,7 +462,7 @@ public:
     /**
      * @brief Remove entity from archetype (swap-and-pop)
      * 
-     * ⚠️ IMPURE (modifies entities_ vector and component arrays)
+     * ⚠️ IMPURE (destroys components, moves last row into the hole)
      * 
      * Returns the entity that was swapped into the removed entity's position
      * (needed to update EntityMeta for that entity).
@@ -185,59 +473,56 @@ public:
     [[nodiscard]] auto remove_entity(u32 index) -> Entity;
     
     /**
-     * @brief Check if archetype has component array for type T
+     * @brief Remove entity whose components were already moved out (swap-and-pop)
      * 
-     * ✨ PURE FUNCTION ✨
+     * ⚠️ IMPURE (moves last row into the hole)
      * 
-     * @param type_id Component type ID
-     * @return true if archetype has this component array
+     * Used by archetype migration: the caller has relocated or destroyed
+     * every component of the row, so only the bookkeeping and the swap of
+     * the last row remain.
+     * 
+     * @param index Index of entity to remove (its component slots are dead)
+     * @return Entity that was swapped (NULL_ENTITY if index was last)
      */
-    [[nodiscard]] auto has_component_array(u32 type_id) const -> bool {
-        return components_.contains(type_id);
-    }
+    [[nodiscard]] auto release_entity(u32 index) -> Entity;
     
     /**
-     * @brief Add component array for type T
+     * @brief Check if archetype has component array for type
      * 
-     * ⚠️ IMPURE (inserts into components_ map)
+     * ✨ PURE FUNCTION ✨
      * 
-     * @tparam T Component type
      * @param type_id Component type ID
+     * @return true if archetype has this component array
      */
-    template<typename T>
-    auto add_component_array(u32 type_id) -> void {
-        components_[type_id] = ComponentArray::create<T>();
+    [[nodiscard]] auto has_component_array(u32 type_id) const -> bool {
+        return type_id < column_index_.size() && column_index_[type_id] != NO_COLUMN;
     }
     
     /**
-     * @brief Add component to entity at index
+     * @brief Get raw pointer to component of entity at index
      * 
-     * ⚠️ IMPURE (appends to component array)
+     * ✨ PURE FUNCTION ✨
      * 
-     * @tparam T Component type
      * @param type_id Component type ID
-     * @param component Component data
+     * @param index Entity index in archetype
+     * @return Pointer to component storage (nullptr if not found)
      */
-    template<typename T>
-    auto add_component(u32 type_id, T component) -> void {
-        if (auto it = components_.find(type_id); it != components_.end()) {
-            it->second->push<T>(std::move(component));
-        }
-    }
+    [[nodiscard]] auto component_raw(u32 type_id, u32 index) const -> std::byte*;
     
     /**
-     * @brief Remove component at entity index
+     * @brief Construct component in place for entity at index
      * 
-     * ⚠️ IMPURE (removes from component array)
+     * ⚠️ IMPURE (placement-new into chunk storage)
      * 
      * @tparam T Component type
      * @param type_id Component type ID
-     * @param index Entity index in archetype
+     * @param index Entity index (slot must be uninitialized)
+     * @param component Component data
      */
     template<typename T>
-    auto remove_component(u32 type_id, u32 index) -> void {
-        if (auto it = components_.find(type_id); it != components_.end()) {
-            it->second->remove<T>(index);
+    auto construct_component(u32 type_id, u32 index, T component) -> void {
+        if (auto* slot = component_raw(type_id, index)) {
+            ::new (slot) T(std::move(component));
         }
     }
     
@@ -253,10 +538,7 @@ public:
      */
     template<typename T>
     [[nodiscard]] auto get_component(u32 type_id, u32 index) const -> const T* {
-        if (auto it = components_.find(type_id); it != components_.end()) {
-            return it->second->get<T>(index);
-        }
-        return nullptr;
+        return std::launder(reinterpret_cast<const T*>(component_raw(type_id, index)));
     }
     
     /**
@@ -271,10 +553,45 @@ public:
      */
     template<typename T>
     [[nodiscard]] auto get_component(u32 type_id, u32 index) -> T* {
-        if (auto it = components_.find(type_id); it != components_.end()) {
-            return it->second->get<T>(index);
+        return std::launder(reinterpret_cast<T*>(component_raw(type_id, index)));
+    }
+    
+    /**
+     * @brief Record a write to one component of entity at index
+     * 
+     * ⚠️ IMPURE (updates change ticks)
+     * 
+     * @param type_id Component type ID
+     * @param index Entity index in archetype
+     * @param tick Tick to record
+     */
+    auto mark_changed(u32 type_id, u32 index, u32 tick) -> void {
+        if (index < size_) {
+            chunks_[index / chunk_capacity_]->mark_row_changed(type_id, index % chunk_capacity_, tick);
         }
-        return nullptr;
+    }
+    
+    /**
+     * @brief Record a write to every component of entity at index
+     * 
+     * ⚠️ IMPURE (updates change ticks)
+     * 
+     * @param index Entity index in archetype
+     * @param tick Tick to record
+     */
+    auto mark_row_changed(u32 index, u32 tick) -> void;
+    
+    /**
+     * @brief Get change tick of one component of entity at index
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID
+     * @param index Entity index in archetype
+     * @return Tick of most recent write (0 if absent)
+     */
+    [[nodiscard]] auto component_tick(u32 type_id, u32 index) const -> u32 {
+        return index < size_ ? chunks_[index / chunk_capacity_]->row_tick(type_id, index % chunk_capacity_) : 0;
     }
     
     /**
@@ -286,7 +603,10 @@ public:
      * @return Entity (NULL_ENTITY if out of bounds)
      */
     [[nodiscard]] auto get_entity(u32 index) const -> Entity {
-        return index < entities_.size() ? entities_[index] : NULL_ENTITY;
+        if (index >= size_) {
+            return NULL_ENTITY;
+        }
+        return chunks_[index / chunk_capacity_]->entities()[index % chunk_capacity_];
     }
     
     /**
@@ -297,7 +617,7 @@ public:
      * @return Entity count
      */
     [[nodiscard]] auto size() const -> std::size_t {
-        return entities_.size();
+        return size_;
     }
     
     /**
@@ -307,14 +627,231 @@ public:
      * 
      * @return Component signature bitset
      */
-    [[nodiscard]] auto signature() const -> ComponentSignature {
+    [[nodiscard]] auto signature() const -> const ComponentSignature& {
         return signature_;
     }
+    
+    /**
+     * @brief Get component columns (layout description)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Columns sorted by type ID
+     */
+    [[nodiscard]] auto columns() const -> std::span<const ArchetypeColumn> {
+        return columns_;
+    }
+    
+    /**
+     * @brief Get column description for a type
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * O(1): direct index into the column table, no hashing.
+     * 
+     * @param type_id Component type ID
+     * @return Pointer to column (nullptr if not present)
+     */
+    [[nodiscard]] auto column(u32 type_id) const -> const ArchetypeColumn* {
+        return has_component_array(type_id) ? &columns_[column_index_[type_id]] : nullptr;
+    }
+    
+    /**
+     * @brief Get number of chunks (including partially filled last chunk)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Chunk count
+     */
+    [[nodiscard]] auto chunk_count() const -> std::size_t {
+        return chunks_.size();
+    }
+    
+    /**
+     * @brief Get chunk by index (read-only)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param index Chunk index (< chunk_count())
+     * @return Chunk reference
+     */
+    [[nodiscard]] auto chunk(std::size_t index) const -> const Chunk& {
+        return *chunks_[index];
+    }
+    
+    /**
+     * @brief Get chunk by index (mutable)
+     * 
+     * ⚠️ IMPURE (allows mutation)
+     * 
+     * @param index Chunk index (< chunk_count())
+     * @return Chunk reference
+     */
+    [[nodiscard]] auto chunk(std::size_t index) -> Chunk& {
+        return *chunks_[index];
+    }
+    
+    /**
+     * @brief Get number of entities one chunk can hold
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Chunk row capacity (>= 1)
+     */
+    [[nodiscard]] auto chunk_capacity() const -> u32 {
+        return chunk_capacity_;
+    }
+    
+    /**
+     * @brief Get size of one chunk allocation in bytes
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return CHUNK_SIZE, or larger if a single row does not fit
+     */
+    [[nodiscard]] auto chunk_bytes() const -> std::size_t {
+        return chunk_bytes_;
+    }
+    
+    /**
+     * @brief Get cached destination for adding a component
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID being added
+     * @return Archetype index (INVALID_ARCHETYPE if not cached yet)
+     */
+    [[nodiscard]] auto add_edge(u32 type_id) const -> u32 {
+        return type_id < add_edges_.size() ? add_edges_[type_id] : INVALID_ARCHETYPE;
+    }
+    
+    /**
+     * @brief Get cached destination for removing a component
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID being removed
+     * @return Archetype index (INVALID_ARCHETYPE if not cached yet)
+     */
+    [[nodiscard]] auto remove_edge(u32 type_id) const -> u32 {
+        return type_id < remove_edges_.size() ? remove_edges_[type_id] : INVALID_ARCHETYPE;
+    }
+    
+    /**
+     * @brief Cache destination for adding a component
+     * 
+     * ⚠️ IMPURE (writes edge table)
+     * 
+     * @param type_id Component type ID being added
+     * @param archetype_index Destination archetype index
+     */
+    auto set_add_edge(u32 type_id, u32 archetype_index) -> void;
+    
+    /**
+     * @brief Cache destination for removing a component
+     * 
+     * ⚠️ IMPURE (writes edge table)
+     * 
+     * @param type_id Component type ID being removed
+     * @param archetype_index Destination archetype index
+     */
+    auto set_remove_edge(u32 type_id, u32 archetype_index) -> void;
+    
+    /**
+     * @brief Rewrite cached graph edges after archetypes were removed
+     * 
+     * ⚠️ IMPURE (writes edge tables)
+     * 
+     * @param remap Old archetype index -> new index (INVALID_ARCHETYPE = removed)
+     */
+    auto remap_edges(std::span<const u32> remap) -> void;
+    
+    /**
+     * @brief Release memory kept for reuse (spare chunk, slack in tables)
+     * 
+     * ⚠️ IMPURE (deallocates memory)
+     */
+    auto shrink() -> void;
+    
+    /**
+     * @brief Reorder rows (relocates every row into freshly packed chunks)
+     * 
+     * ⚠️ IMPURE (moves components; row indices change)
+     * 
+     * Rows keep their change ticks. The caller must update EntityMeta of
+     * every entity afterwards (row i now holds get_entity(i)).
+     * 
+     * @param order New row i takes the row previously at order[i] (a permutation of [0, size()))
+     */
+    auto reorder(std::span<const u32> order) -> void;
+    
+    /**
+     * @brief Exchange two rows in place
+     * 
+     * ⚠️ IMPURE (moves components; row indices change)
+     * 
+     * Rows keep their change ticks (column-wide writes of both chunks are
+     * first folded into their rows). The caller must update EntityMeta of
+     * both entities afterwards.
+     * 
+     * @param a Row index (< size())
+     * @param b Row index (< size())
+     */
+    auto swap_rows(u32 a, u32 b) -> void;
 
 private:
+    /**
+     * @brief Compute chunk capacity and column offsets
+     * 
+     * ⚠️ IMPURE (writes layout members)
+     */
+    auto compute_layout() -> void;
+    
+    /**
+     * @brief Destroy every component in a row
+     * 
+     * ⚠️ IMPURE (calls destructors)
+     * 
+     * @param chunk Chunk containing the row
+     * @param row Row inside chunk
+     */
+    auto destroy_row(Chunk& chunk, u32 row) -> void;
+    
     ComponentSignature signature_;  ///< Component signature bitset
-    std::vector<Entity> entities_;  ///< All entities in this archetype
-    std::unordered_map<u32, std::unique_ptr<ComponentArray>> components_;  ///< Component arrays (one per type)
+    std::vector<ArchetypeColumn> columns_;  ///< Component columns (sorted by type ID)
+    std::vector<u8> column_index_;  ///< Type ID -> slot in columns_ (NO_COLUMN if absent), sized to highest ID + 1
+    
+    u32 chunk_capacity_{1};  ///< Entities per chunk
+    std::size_t chunk_bytes_{CHUNK_SIZE};  ///< Bytes per chunk allocation
+    
+    std::vector<std::unique_ptr<Chunk>> chunks_;  ///< Chunks in row order (last may be partial)
+    std::unique_ptr<Chunk> spare_chunk_;  ///< One empty chunk kept to avoid alloc/free thrash
+    u32 size_{0};  ///< Total live entities across chunks
+    
+    std::vector<u32> add_edges_;  ///< Type ID -> archetype with that component added
+    std::vector<u32> remove_edges_;  ///< Type ID -> archetype with that component removed
+    
+    static constexpr u8 NO_COLUMN = 0xFF;  ///< Marks an absent column in column_index_
 };
 
+// ========== Chunk Inline Implementations ==========
+
+inline auto Chunk::capacity() const -> u32 {
+    return owner_->chunk_capacity();
+}
+
+inline auto Chunk::column_raw(u32 type_id) const -> std::byte* {
+    const auto* col = owner_->column(type_id);
+    return col ? data_ + col->offset : nullptr;
+}
+
+inline auto Chunk::tick_block_at(std::size_t slot) const -> u32* {
+    return ticks_.get() + slot * (FIRST_ROW_TICK + std::size_t{owner_->chunk_capacity()});
+}
+
+inline auto Chunk::tick_block(u32 type_id) const -> u32* {
+    const auto* col = owner_->column(type_id);
+    return col ? tick_block_at(static_cast<std::size_t>(col - owner_->columns().data())) : nullptr;
+}
+
 } // namespace luma::scene
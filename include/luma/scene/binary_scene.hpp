@@ -0,0 +1,119 @@
+/**
+ * @file binary_scene.hpp
+ * @brief Binary scene format (.lscene) with memory-mapped loading
+ * 
+ * YAML (serialization.hpp) stays the authoring format; .lscene is the
+ * shipping / fast-load format built from it. A 1M-entity YAML scene takes
+ * seconds to parse node by node; an .lscene file is mapped into memory and
+ * copied into archetype chunks one column slice at a time.
+ * 
+ * **Layout** (version 2, host byte order, checked on load):
+ * @code
+ * SceneFileHeader                       magic, version, counts, table offsets
+ * column data                           each column starts 64-byte aligned
+ * ComponentRecord[component_count]      name, layout hash
+ * BlockRecord[block_count]              one per archetype / sparse set
+ * ColumnRecord[column_count]            per block: component, encoding, range
+ * name bytes
+ * @endcode
+ * 
+ * Column data is streamed out first and the (small) tables appended after
+ * it, so saving never buffers more than one chunk column.
+ * 
+ * - Archetype blocks store every table column contiguously: trivially
+ *   copyable components whose fields cover every byte and include no bool
+ *   as raw rows (one memcpy per chunk on load), others (e.g. Name, or
+ *   Geometry with its padding) as write_fields() records. Tags are a column
+ *   with no data.
+ * - Sparse-set components get their own block: the values plus the file
+ *   index of the entity each belongs to. Entities are numbered in block
+ *   order; entities that live in no archetype come last.
+ * - Components are identified by registry name and checked against a hash
+ *   of their reflected layout, so a file written before a component
+ *   changed is refused (COMPONENT_LAYOUT_MISMATCH) instead of misread;
+ *   rebuild it from the YAML source.
+ * 
+ * As with YAML, only named, reflected components (and named tags) are
+ * stored; entity handles are reassigned on load.
+ * 
+ * Example:
+ * @code
+ * // asset build step
+ * convert_scene("scenes/level1.yaml", "build/level1.lscene");
+ * 
+ * // runtime
+ * World world;
+ * if (auto result = load_binary_scene(world, "build/level1.lscene"); !result) {
+ *     LOG_ERROR("Load failed: {}", error_to_string(result.error()));
+ * }
+ * @endcode
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+#include <luma/scene/serialization.hpp>
+#include <luma/scene/world.hpp>
+
+#include <expected>
+#include <filesystem>
+
+namespace luma::scene {
+
+/**
+ * @brief Current .lscene format version
+ */
+inline constexpr u32 BINARY_SCENE_VERSION = 2;
+
+/**
+ * @brief Save world to a binary .lscene file
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * @param world World to serialize
+ * @param path Output file path (parent directories are created)
+ * @return Success (void) or error code
+ */
+auto save_binary_scene(
+    const World& world,
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError>;
+
+/**
+ * @brief Load world from a binary .lscene file (memory-mapped)
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * The whole file is validated before the world is touched: on error the
+ * world is left as it was.
+ * 
+ * @param world World to populate (cleared first on success)
+ * @param path Input file path
+ * @return Success (void) or error code (COMPONENT_LAYOUT_MISMATCH if a
+ *         component changed since the file was written)
+ */
+auto load_binary_scene(
+    World& world,
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError>;
+
+/**
+ * @brief Convert a scene between YAML (.yaml / .yml) and binary (.lscene)
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * The format of each side is chosen by file extension.
+ * 
+ * @param from Source scene
+ * @param to Destination scene
+ * @return Success (void) or error code
+ */
+auto convert_scene(
+    const std::filesystem::path& from,
+    const std::filesystem::path& to
+) -> std::expected<void, SerializationError>;
+
+} // namespace luma::scene
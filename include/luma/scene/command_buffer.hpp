@@ -0,0 +1,304 @@
+/**
+ * @file command_buffer.hpp
+ * @brief Deferred structural changes for LUMA ECS
+ * 
+ * Creating/destroying entities or adding/removing components while iterating
+ * (World::each, par_each, Query) would move rows out from under the
+ * iteration. A CommandBuffer records those operations instead; they are
+ * applied in one batch at a sync point, after the iteration has finished.
+ * 
+ * Example:
+ * @code
+ * CommandBuffer commands;
+ * world.each<Transform, Health>([&](Entity e, const Transform& t, const Health& h) {
+ *     if (h.value <= 0) {
+ *         commands.destroy(e);
+ *         commands.spawn(Transform{t}, Explosion{});
+ *     }
+ * });
+ * commands.apply(world);  // sync point
+ * @endcode
+ * 
+ * For parallel iteration use ThreadCommandBuffers, which hands every worker
+ * thread its own CommandBuffer (no locking while recording).
+ * 
+ * ⚠️ IMPURE (records and later mutates world state)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+#include <luma/scene/entity.hpp>
+#include <luma/scene/registry.hpp>
+#include <luma/scene/world.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Kind of recorded operation
+ */
+enum class CommandKind : u8 {
+    SPAWN,  ///< Create entity; followed by component_count SPAWN_COMPONENT entries
+    SPAWN_COMPONENT,  ///< One component of the preceding SPAWN
+    DESTROY,  ///< Destroy entity
+    ADD,  ///< Add (or replace) one component
+    REMOVE,  ///< Remove one component
+};
+
+/**
+ * @brief Single recorded operation (internal)
+ * 
+ * ✨ VALUE TYPE ✨
+ */
+struct Command {
+    CommandKind kind{CommandKind::DESTROY};  ///< Operation
+    Entity entity{NULL_ENTITY};  ///< Target entity (DESTROY/ADD/REMOVE)
+    u32 type_id{INVALID_COMPONENT};  ///< Component type (ADD/REMOVE/SPAWN_COMPONENT)
+    u32 component_count{0};  ///< Number of components (SPAWN)
+    std::byte* payload{nullptr};  ///< Recorded component (ADD/SPAWN_COMPONENT; nullptr once consumed)
+};
+
+/**
+ * @brief Recorder of deferred spawn/destroy/add/remove operations
+ * 
+ * Components are moved into an internal arena when recorded and relocated
+ * straight into chunk storage when applied (no further copies).
+ * 
+ * **Apply order** (apply() / sync point):
+ * 1. Operations on existing entities, grouped by the entity's archetype
+ *    (stable: operations on one entity keep their recorded order)
+ * 2. Spawns, grouped by destination archetype (resolved once per group)
+ * 
+ * ⚠️ IMPURE CLASS (owns recorded components)
+ * 
+ * @note A single CommandBuffer is not thread-safe; use one per thread
+ */
+class CommandBuffer {
+public:
+    CommandBuffer() = default;
+    
+    /**
+     * @brief Destructor (destroys components of unapplied commands)
+     */
+    ~CommandBuffer();
+    
+    // Non-copyable (owns components), move-constructible
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+    CommandBuffer(CommandBuffer&&) noexcept = default;
+    CommandBuffer& operator=(CommandBuffer&&) = delete;
+    
+    /**
+     * @brief Record creation of an entity with components
+     * 
+     * ⚠️ IMPURE (records command)
+     * 
+     * @tparam Components Component types (each type at most once)
+     * @param components Component data (moved into the buffer)
+     */
+    template<typename... Components>
+    auto spawn(Components&&... components) -> void {
+        static_assert(sizeof...(Components) > 0, "spawn() needs at least one component");
+        static_assert(are_distinct_components_v<Components...>, "spawn() takes each component type at most once");
+        commands_.push_back(Command{
+            .kind = CommandKind::SPAWN,
+            .component_count = static_cast<u32>(sizeof...(Components)),
+        });
+        (commands_.push_back(Command{
+            .kind = CommandKind::SPAWN_COMPONENT,
+            .type_id = component_id<Components>(),
+            .payload = store(std::forward<Components>(components)),
+        }), ...);
+    }
+    
+    /**
+     * @brief Record destruction of an entity
+     * 
+     * ⚠️ IMPURE (records command)
+     * 
+     * @param entity Entity to destroy (ignored at apply time if already dead)
+     */
+    auto destroy(Entity entity) -> void {
+        commands_.push_back(Command{.kind = CommandKind::DESTROY, .entity = entity});
+    }
+    
+    /**
+     * @brief Record adding (or replacing) a component
+     * 
+     * ⚠️ IMPURE (records command)
+     * 
+     * @tparam T Component type
+     * @param entity Target entity
+     * @param component Component data (moved into the buffer)
+     */
+    template<typename T>
+    auto add(Entity entity, T component) -> void {
+        commands_.push_back(Command{
+            .kind = CommandKind::ADD,
+            .entity = entity,
+            .type_id = component_id<T>(),
+            .payload = store(std::move(component)),
+        });
+    }
+    
+    /**
+     * @brief Record removal of a component
+     * 
+     * ⚠️ IMPURE (records command)
+     * 
+     * @tparam T Component type
+     * @param entity Target entity
+     */
+    template<typename T>
+    auto remove(Entity entity) -> void {
+        commands_.push_back(Command{.kind = CommandKind::REMOVE, .entity = entity, .type_id = component_id<T>()});
+    }
+    
+    /**
+     * @brief Apply all recorded operations to a world, then clear
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * Must be called from a single thread while nothing iterates the world.
+     * 
+     * @param world Target world
+     */
+    auto apply(World& world) -> void;
+    
+    /**
+     * @brief Take over all commands recorded in another buffer
+     * 
+     * ⚠️ IMPURE (moves commands and their components)
+     * 
+     * @param other Buffer to drain (empty afterwards)
+     */
+    auto merge(CommandBuffer& other) -> void;
+    
+    /**
+     * @brief Discard all recorded operations
+     * 
+     * ⚠️ IMPURE (destroys recorded components)
+     */
+    auto clear() -> void;
+    
+    /**
+     * @brief Get number of recorded entries (spawn components count separately)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto size() const -> std::size_t {
+        return commands_.size();
+    }
+    
+    /**
+     * @brief Check whether nothing is recorded
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto empty() const -> bool {
+        return commands_.empty();
+    }
+
+private:
+    /**
+     * @brief Aligned arena block (never reallocated, so payload pointers stay valid)
+     */
+    struct Block {
+        std::byte* data{nullptr};  ///< Block memory (BLOCK_ALIGNMENT aligned)
+        std::size_t capacity{0};  ///< Bytes in block
+        std::size_t used{0};  ///< Bytes handed out
+    };
+    
+    static constexpr std::size_t BLOCK_SIZE = CHUNK_SIZE;
+    static constexpr std::size_t BLOCK_ALIGNMENT = CHUNK_ALIGNMENT;
+    
+    /**
+     * @brief Move a component into the arena
+     */
+    template<typename T>
+    auto store(T&& component) -> std::byte* {
+        using Component = std::remove_cvref_t<T>;
+        static_assert(alignof(Component) <= BLOCK_ALIGNMENT, "Component alignment exceeds command arena alignment");
+        std::byte* slot = allocate(sizeof(Component), alignof(Component));
+        ::new (slot) Component(std::forward<T>(component));
+        return slot;
+    }
+    
+    auto allocate(std::size_t size, std::size_t alignment) -> std::byte*;
+    auto release_blocks() -> void;
+    
+    std::vector<Command> commands_;  ///< Recorded operations in order
+    std::vector<Block> blocks_;  ///< Payload arena
+};
+
+/**
+ * @brief One CommandBuffer per thread for parallel recording
+ * 
+ * Each thread records into its own buffer without contention; apply()
+ * merges them at the sync point and applies the batch. A thread takes the
+ * lock only the first time it asks an instance for its buffer; after that
+ * local() is a thread_local lookup.
+ * 
+ * @code
+ * ThreadCommandBuffers commands;
+ * world.par_each<Transform, Particle>(jobs, [&](Entity e, Transform&, Particle& p) {
+ *     if (p.age > p.lifetime) {
+ *         commands.local().destroy(e);
+ *     }
+ * });
+ * commands.apply(world);
+ * @endcode
+ * 
+ * ⚠️ IMPURE CLASS (thread-safe local(), single-threaded apply())
+ */
+class ThreadCommandBuffers {
+public:
+    /**
+     * @brief Create an empty set of buffers (one is added per recording thread)
+     */
+    ThreadCommandBuffers();
+    
+    ThreadCommandBuffers(const ThreadCommandBuffers&) = delete;
+    ThreadCommandBuffers& operator=(const ThreadCommandBuffers&) = delete;
+    
+    /**
+     * @brief Get the calling thread's buffer (created on first use)
+     * 
+     * ⚠️ IMPURE (may allocate a buffer)
+     * 
+     * Lock-free when the calling thread used this instance last; otherwise
+     * one locked lookup refreshes the thread's cache.
+     * 
+     * @return Buffer owned by the calling thread until apply()
+     */
+    [[nodiscard]] auto local() -> CommandBuffer&;
+    
+    /**
+     * @brief Merge all thread buffers and apply them to a world
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * @param world Target world
+     */
+    auto apply(World& world) -> void;
+
+private:
+    u64 instance_;  ///< Process-unique (never reused) key of the per-thread cache
+    std::mutex mutex_;  ///< Guards buffers_ (lookup/creation only)
+    std::unordered_map<std::thread::id, std::unique_ptr<CommandBuffer>> buffers_;  ///< Per-thread buffers
+};
+
+} // namespace luma::scene
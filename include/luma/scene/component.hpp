@@ -24,17 +24,271 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/matrix_decompose.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <functional>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace luma::scene {
 
 /**
  * @brief Component signature - bitset identifying which components an entity has
  * 
- * Each bit represents a different component type (0-63 max components).
- * Used for fast archetype matching.
+ * Each bit represents a component type ID (see ComponentRegistry). The bitset
+ * grows on demand, so the number of component types is not capped at 64.
+ * Used for fast archetype matching and as the archetype lookup key.
+ * 
+ * Signatures are kept normalized (no trailing zero words), so two signatures
+ * with the same bits always compare and hash equal.
+ * 
+ * ✨ VALUE TYPE ✨
  */
-using ComponentSignature = u64;
+class ComponentSignature {
+public:
+    ComponentSignature() = default;
+    
+    /**
+     * @brief Check whether a component bit is set
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID
+     * @return true if bit is set
+     */
+    [[nodiscard]] auto test(u32 type_id) const -> bool {
+        const auto word = type_id / BITS_PER_WORD;
+        return word < words_.size() && ((words_[word] >> (type_id % BITS_PER_WORD)) & 1u) != 0;
+    }
+    
+    /**
+     * @brief Set a component bit
+     * 
+     * ⚠️ IMPURE (modifies signature)
+     * 
+     * @param type_id Component type ID
+     * @return *this
+     */
+    auto set(u32 type_id) -> ComponentSignature& {
+        const auto word = type_id / BITS_PER_WORD;
+        if (word >= words_.size()) {
+            words_.resize(word + 1, 0);
+        }
+        words_[word] |= u64{1} << (type_id % BITS_PER_WORD);
+        return *this;
+    }
+    
+    /**
+     * @brief Clear a component bit
+     * 
+     * ⚠️ IMPURE (modifies signature)
+     * 
+     * @param type_id Component type ID
+     * @return *this
+     */
+    auto reset(u32 type_id) -> ComponentSignature& {
+        const auto word = type_id / BITS_PER_WORD;
+        if (word < words_.size()) {
+            words_[word] &= ~(u64{1} << (type_id % BITS_PER_WORD));
+            while (!words_.empty() && words_.back() == 0) {
+                words_.pop_back();
+            }
+        }
+        return *this;
+    }
+    
+    /**
+     * @brief Copy of this signature with one more component
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID to add
+     * @return New signature
+     */
+    [[nodiscard]] auto with(u32 type_id) const -> ComponentSignature {
+        ComponentSignature result = *this;
+        result.set(type_id);
+        return result;
+    }
+    
+    /**
+     * @brief Copy of this signature without one component
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID to remove
+     * @return New signature
+     */
+    [[nodiscard]] auto without(u32 type_id) const -> ComponentSignature {
+        ComponentSignature result = *this;
+        result.reset(type_id);
+        return result;
+    }
+    
+    /**
+     * @brief Check whether every bit of another signature is set here
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param other Required components
+     * @return true if this is a superset of other
+     */
+    [[nodiscard]] auto contains(const ComponentSignature& other) const -> bool {
+        if (other.words_.size() > words_.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < other.words_.size(); ++i) {
+            if ((words_[i] & other.words_[i]) != other.words_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Check whether any bit is shared with another signature
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param other Signature to test against
+     * @return true if at least one component is in both
+     */
+    [[nodiscard]] auto intersects(const ComponentSignature& other) const -> bool {
+        const auto n = std::min(words_.size(), other.words_.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            if ((words_[i] & other.words_[i]) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * @brief Check whether no bit is set
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return true if signature is empty
+     */
+    [[nodiscard]] auto empty() const -> bool {
+        return words_.empty();
+    }
+    
+    /**
+     * @brief Count set bits
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Number of components in the signature
+     */
+    [[nodiscard]] auto count() const -> u32 {
+        u32 total = 0;
+        for (const auto word : words_) {
+            total += static_cast<u32>(std::popcount(word));
+        }
+        return total;
+    }
+    
+    /**
+     * @brief Hash of the set bits
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Hash value (equal signatures hash equal)
+     */
+    [[nodiscard]] auto hash() const -> std::size_t {
+        std::size_t h = words_.size();
+        for (const auto word : words_) {
+            h ^= std::hash<u64>{}(word) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+    
+    /**
+     * @brief Equality (same set of components)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    friend auto operator==(const ComponentSignature&, const ComponentSignature&) -> bool = default;
+
+private:
+    static constexpr u32 BITS_PER_WORD = 64;
+    
+    std::vector<u64> words_;  ///< Bit words, normalized (no trailing zero words)
+};
+
+/**
+ * @brief Where a component type's data lives
+ */
+enum class StoragePolicy : u8 {
+    TABLE,  ///< Archetype chunk column (fastest iteration; add/remove migrates the entity)
+    SPARSE,  ///< Per-type sparse set (add/remove without migration; for frequently toggled components)
+    TAG,  ///< Signature bit only, no per-entity storage (default for empty types)
+};
+
+/**
+ * @brief Storage policy of component type T
+ * 
+ * Empty types (std::is_empty_v) default to StoragePolicy::TAG: they only
+ * split archetypes, so filtering on them costs nothing per entity. Every
+ * other type defaults to StoragePolicy::TABLE. A component opts into sparse-set
+ * storage with a static member, or by specializing this trait:
+ * @code
+ * struct Hit {
+ *     static constexpr StoragePolicy storage_policy = StoragePolicy::SPARSE;
+ *     f32 damage{0.0f};
+ * };
+ * @endcode
+ * 
+ * Only empty types may be tags: a tag has nowhere to keep data, so asking
+ * for StoragePolicy::TAG on a type with members is a compile error.
+ * 
+ * @tparam T Component type
+ */
+template<typename T>
+struct ComponentStorage {
+    static constexpr StoragePolicy value = [] {
+        if constexpr (requires { { T::storage_policy } -> std::convertible_to<StoragePolicy>; }) {
+            return static_cast<StoragePolicy>(T::storage_policy);
+        } else if constexpr (std::is_empty_v<T>) {
+            return StoragePolicy::TAG;
+        } else {
+            return StoragePolicy::TABLE;
+        }
+    }();
+    static_assert(value != StoragePolicy::TAG || std::is_empty_v<T>,
+                  "StoragePolicy::TAG stores no data; only empty types can be tags");
+};
+
+/**
+ * @brief True if T (cv-qualifiers ignored) uses sparse-set storage
+ */
+template<typename T>
+inline constexpr bool is_sparse_component_v =
+    ComponentStorage<std::remove_cvref_t<T>>::value == StoragePolicy::SPARSE;
+
+/**
+ * @brief True if T (cv-qualifiers ignored) is a data-less tag component
+ */
+template<typename T>
+inline constexpr bool is_tag_component_v =
+    ComponentStorage<std::remove_cvref_t<T>>::value == StoragePolicy::TAG;
+
+/**
+ * @brief True if no component type (cv/ref qualifiers ignored) appears twice
+ * 
+ * An entity holds at most one component of each type; spawning with a
+ * repeated type would build an archetype with two columns for it.
+ */
+template<typename... Components>
+inline constexpr bool are_distinct_components_v = true;
+
+template<typename First, typename... Rest>
+inline constexpr bool are_distinct_components_v<First, Rest...> =
+    (!std::is_same_v<std::remove_cvref_t<First>, std::remove_cvref_t<Rest>> && ...)
+    && are_distinct_components_v<Rest...>;
 
 /**
  * @brief Transform component (position, rotation, scale)
@@ -232,3 +486,13 @@ struct Name {
 };
 
 } // namespace luma::scene
+
+/**
+ * @brief Hash support so ComponentSignature can key unordered containers
+ */
+template<>
+struct std::hash<luma::scene::ComponentSignature> {
+    auto operator()(const luma::scene::ComponentSignature& signature) const noexcept -> std::size_t {
+        return signature.hash();
+    }
+};
@@ -24,14 +24,38 @@
 
 namespace luma::scene {
 
+/**
+ * @brief Entity handle width (selected at build time)
+ * 
+ * - Default: 32-bit handle, 24-bit ID + 8-bit generation (16M entities,
+ *   stale handles detected across 256 reuses of an ID)
+ * - LUMA_ENTITY_64BIT (CMake option of the same name): 64-bit handle,
+ *   32-bit ID + 32-bit generation, for high-churn workloads (particles)
+ *   where an 8-bit generation wraps within seconds
+ */
+#if defined(LUMA_ENTITY_64BIT) && LUMA_ENTITY_64BIT
+using EntityValue = u64;  ///< Packed handle storage
+using EntityGeneration = u32;  ///< Generation counter type
+inline constexpr u32 ENTITY_ID_BITS = 32;
+#else
+using EntityValue = u32;  ///< Packed handle storage
+using EntityGeneration = u8;  ///< Generation counter type
+inline constexpr u32 ENTITY_ID_BITS = 24;
+#endif
+
+/**
+ * @brief Mask of the ID bits in a packed handle (also the largest ID)
+ */
+inline constexpr EntityValue ENTITY_ID_MASK = (EntityValue{1} << ENTITY_ID_BITS) - 1;
+
 /**
  * @brief Unique identifier for an entity
  * 
  * Entities are composed of:
- * - **ID (lower 24 bits)**: Index into entity storage (max 16 million entities)
- * - **Generation (upper 8 bits)**: Incremented when entity destroyed (detect stale handles)
+ * - **ID (lower ENTITY_ID_BITS bits)**: Index into entity storage (max 16 million entities, 4 billion in 64-bit mode)
+ * - **Generation (upper bits)**: Incremented when entity destroyed (detect stale handles)
  * 
- * This 32-bit design enables:
+ * This packed design enables:
  * - Compact representation (fits in register, cache-friendly)
  * - Fast comparison (single integer compare)
  * - Stale handle detection (prevent use-after-free)
@@ -41,7 +65,7 @@ namespace luma::scene {
  * @note Entities are created by World, never constructed directly by users
  */
 struct Entity {
-    u32 value;  ///< Packed ID (24 bits) + generation (8 bits)
+    EntityValue value;  ///< Packed ID (low bits) + generation (high bits)
     
     /**
      * @brief Construct null entity (ID=0, generation=0)
@@ -57,18 +81,18 @@ struct Entity {
      * 
      * @param val Packed ID + generation
      */
-    explicit constexpr Entity(u32 val) noexcept : value(val) {}
+    explicit constexpr Entity(EntityValue val) noexcept : value(val) {}
     
     /**
      * @brief Construct entity from ID and generation
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * @param id Entity ID (24 bits max)
-     * @param gen Generation counter (8 bits max)
+     * @param id Entity ID (ENTITY_ID_BITS bits max)
+     * @param gen Generation counter
      */
-    constexpr Entity(u32 id, u8 gen) noexcept 
-        : value((id & 0x00FFFFFF) | (static_cast<u32>(gen) << 24)) 
+    constexpr Entity(u32 id, EntityGeneration gen) noexcept 
+        : value((static_cast<EntityValue>(id) & ENTITY_ID_MASK) | (static_cast<EntityValue>(gen) << ENTITY_ID_BITS)) 
     {}
     
     /**
@@ -76,11 +100,11 @@ struct Entity {
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * @param id Entity ID (24 bits max)
-     * @param gen Generation counter (8 bits max)
+     * @param id Entity ID (ENTITY_ID_BITS bits max)
+     * @param gen Generation counter
      * @return New Entity with specified ID and generation
      */
-    [[nodiscard]] static constexpr auto create(u32 id, u8 gen) noexcept -> Entity {
+    [[nodiscard]] static constexpr auto create(u32 id, EntityGeneration gen) noexcept -> Entity {
         return Entity(id, gen);
     }
     
@@ -89,10 +113,10 @@ struct Entity {
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * @return Entity ID (0 to 16,777,215)
+     * @return Entity ID (0 to ENTITY_ID_MASK)
      */
     [[nodiscard]] constexpr auto id() const noexcept -> u32 {
-        return value & 0x00FFFFFF;
+        return static_cast<u32>(value & ENTITY_ID_MASK);
     }
     
     /**
@@ -100,10 +124,10 @@ struct Entity {
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * @return Generation (0 to 255)
+     * @return Generation (0 to 255, or 0 to 2^32-1 in 64-bit mode)
      */
-    [[nodiscard]] constexpr auto generation() const noexcept -> u8 {
-        return static_cast<u8>(value >> 24);
+    [[nodiscard]] constexpr auto generation() const noexcept -> EntityGeneration {
+        return static_cast<EntityGeneration>(value >> ENTITY_ID_BITS);
     }
     
     /**
@@ -164,6 +188,6 @@ inline constexpr Entity NULL_ENTITY = Entity();
 template<>
 struct std::hash<luma::scene::Entity> {
     [[nodiscard]] auto operator()(const luma::scene::Entity& entity) const noexcept -> std::size_t {
-        return std::hash<luma::u32>{}(entity.value);
+        return std::hash<luma::scene::EntityValue>{}(entity.value);
     }
 };
@@ -0,0 +1,220 @@
+/**
+ * @file hierarchy.hpp
+ * @brief Parent/child relationships and world-transform propagation
+ * 
+ * Transform stores a local TRS relative to the entity's Parent (or to the
+ * world for roots). WorldTransform caches the composed world matrix so
+ * consumers read one mat4 instead of walking the chain themselves.
+ * 
+ * **Propagation** (TransformHierarchy::propagate):
+ * - Nodes are kept in breadth-first depth levels (level 0 = roots). Level k
+ *   only reads level k-1 results, so each level is one parallel batch:
+ *   workers do the component lookups as well as the matrix products.
+ * - Only dirty subtrees are visited: a node is recomputed if its Transform
+ *   or WorldTransform was written since the last propagation, or if its
+ *   parent was recomputed. Dirtiness comes from the world's change ticks;
+ *   chunks with no changed rows are skipped without touching their rows.
+ * - The level layout is cached and rebuilt only when Parent/Children change
+ *   or an unknown node shows up.
+ * 
+ * Example:
+ * @code
+ * Entity ship = world.spawn(Transform{}, WorldTransform{});
+ * Entity turret = world.spawn(Transform{.position = {0, 2, 0}}, WorldTransform{});
+ * set_parent(world, turret, ship);
+ * 
+ * TransformHierarchy hierarchy;
+ * 
+ * // every frame
+ * world.advance_tick();
+ * run_systems(world);
+ * hierarchy.propagate(world, jobs);
+ * @endcode
+ * 
+ * **Contract**: relationships are edited through set_parent/remove_parent/
+ * destroy_recursive (they keep Parent and Children consistent). Run
+ * propagate() once per tick, after the systems that move things. It starts
+ * a new change tick when done, so writes made after it (even in the same
+ * frame) are picked up by the next propagate().
+ * 
+ * ⚠️ IMPURE (mutates world components, advances the change tick)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/jobs.hpp>
+#include <luma/core/math.hpp>
+#include <luma/core/types.hpp>
+#include <luma/scene/entity.hpp>
+#include <luma/scene/world.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Parent of an entity (its Transform is relative to this entity)
+ * 
+ * ✨ PURE DATA STRUCTURE ✨
+ */
+struct Parent {
+    Entity entity{NULL_ENTITY};  ///< Parent entity
+};
+
+/**
+ * @brief Direct children of an entity (kept in sync with their Parent)
+ * 
+ * ✨ PURE DATA STRUCTURE ✨
+ */
+struct Children {
+    std::vector<Entity> entities;  ///< Child entities in attach order
+};
+
+/**
+ * @brief Cached world-space matrix (written by TransformHierarchy)
+ * 
+ * ✨ PURE DATA STRUCTURE ✨
+ */
+struct WorldTransform {
+    mat4 matrix{1.0f};  ///< Local-to-world matrix
+    
+    /**
+     * @brief Get world-space position (translation column)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto position() const -> vec3 {
+        return vec3(matrix[3]);
+    }
+};
+
+/**
+ * @brief Attach child to parent (detaching it from its previous parent)
+ * 
+ * ⚠️ IMPURE (structural changes on child, old parent and new parent)
+ * 
+ * Adds a default WorldTransform to either entity if missing. Refuses to
+ * create a cycle (parent inside child's subtree) or self-parenting.
+ * 
+ * @param world World owning both entities
+ * @param child Entity to attach
+ * @param parent New parent
+ * @return true if attached
+ */
+auto set_parent(World& world, Entity child, Entity parent) -> bool;
+
+/**
+ * @brief Detach child from its parent (child becomes a root)
+ * 
+ * ⚠️ IMPURE (structural changes on child and parent)
+ * 
+ * @param world World owning the entity
+ * @param child Entity to detach
+ */
+auto remove_parent(World& world, Entity child) -> void;
+
+/**
+ * @brief Destroy an entity and its whole subtree
+ * 
+ * ⚠️ IMPURE (destroys entities, detaches from parent)
+ * 
+ * @param world World owning the entity
+ * @param entity Subtree root
+ */
+auto destroy_recursive(World& world, Entity entity) -> void;
+
+/**
+ * @brief Depth-ordered WorldTransform propagation with dirty-subtree skipping
+ * 
+ * ⚠️ IMPURE CLASS (caches level layout, writes WorldTransform)
+ * 
+ * Nodes are entities with Transform and WorldTransform. An entity whose
+ * Parent is missing, dead or not a node is treated as a root.
+ * 
+ * @note One TransformHierarchy drives one World
+ */
+class TransformHierarchy {
+public:
+    /**
+     * @brief Recompute dirty WorldTransforms serially
+     * 
+     * ⚠️ IMPURE (writes WorldTransform, starts a new change tick)
+     * 
+     * @param world World to update
+     */
+    auto propagate(World& world) -> void;
+    
+    /**
+     * @brief Recompute dirty WorldTransforms, one parallel batch per depth level
+     * 
+     * ⚠️ IMPURE (writes WorldTransform concurrently, starts a new change tick)
+     * 
+     * Small levels run on the calling thread (no job overhead).
+     * 
+     * @param world World to update
+     * @param jobs Job system executing large levels
+     */
+    auto propagate(World& world, JobSystem& jobs) -> void;
+    
+    /**
+     * @brief Force full recomputation (and layout rebuild) on next propagate()
+     * 
+     * ⚠️ IMPURE (invalidates cache)
+     */
+    auto invalidate() -> void {
+        built_ = false;
+    }
+    
+    /**
+     * @brief Get cached depth levels (level 0 = roots)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Node entities per depth, as of the last propagate()
+     */
+    [[nodiscard]] auto levels() const -> const std::vector<std::vector<Entity>>& { return levels_; }
+    
+    /**
+     * @brief Get number of WorldTransforms written by the last propagate()
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto last_updated() const -> std::size_t { return last_updated_; }
+
+private:
+    /**
+     * @brief Shared implementation (jobs may be nullptr)
+     */
+    auto run(World& world, JobSystem* jobs) -> void;
+    
+    /**
+     * @brief Rebuild depth levels by breadth-first walk from the roots
+     */
+    auto build(const World& world) -> void;
+    
+    /**
+     * @brief Collect dirty nodes per depth (seeds from change ticks, then their subtrees)
+     * 
+     * @param world World to inspect
+     * @param dirty Output: dirty nodes per depth level
+     * @return false if an unknown node was found (layout is stale)
+     */
+    auto collect_dirty(const World& world, std::vector<std::vector<Entity>>& dirty) const -> bool;
+    
+    /**
+     * @brief Check for Parent/Children writes since the last propagation
+     */
+    [[nodiscard]] auto structure_changed(const World& world) const -> bool;
+    
+    std::vector<std::vector<Entity>> levels_;  ///< Node entities per depth
+    std::unordered_map<Entity, u32> depth_;  ///< Node -> depth level
+    u32 last_tick_{0};  ///< Last world tick covered by a propagation (later writes are newer)
+    std::size_t last_updated_{0};  ///< WorldTransforms written by the last propagation
+    bool built_{false};  ///< Layout is valid
+};
+
+} // namespace luma::scene
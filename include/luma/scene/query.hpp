@@ -0,0 +1,375 @@
+/**
+ * @file query.hpp
+ * @brief Persistent cached queries for LUMA ECS
+ * 
+ * World::each() re-tests every archetype's signature on every call. A Query
+ * remembers which archetypes matched and, on each use, only tests archetypes
+ * created since its last refresh (archetypes are append-only), so per-frame
+ * systems pay the matching cost once instead of every frame.
+ * 
+ * **Query terms**:
+ * - `T` / `const T`: entity must have T; passed as T& (span<T> per chunk)
+ * - `Optional<T>`: T may be absent; passed as T* (nullptr if absent; empty span per chunk)
+ * - `With<T>`: entity must have T; not passed to the callback
+ * - `Without<T>`: entity must NOT have T; not passed to the callback
+ * 
+ * Tag components (empty types) can only be used with With<T> / Without<T>;
+ * they are pure archetype filters with no per-entity cost.
+ * 
+ * Example:
+ * @code
+ * Query<Transform, const Velocity, Optional<Name>, Without<Frozen>> movers{world};
+ * 
+ * // every frame
+ * movers.each([dt](Entity e, Transform& t, const Velocity& v, const Name* name) {
+ *     t.position += v.linear * dt;
+ * });
+ * @endcode
+ * 
+ * ⚠️ IMPURE CLASS (caches archetype indices, hands out mutable references)
+ * 
+ * Sparse-set components (StoragePolicy::SPARSE) may appear in any term;
+ * such queries visit entities one by one (driven by the smallest required
+ * sparse set) and do not support each_chunk().
+ * 
+ * @note A Query refers to one World; it must not outlive it (or survive a move of it)
+ * @note World::clear() is detected through the archetype epoch and rebuilds the cache
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+#include <luma/scene/world.hpp>
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Query term: entity must have T (component not passed to callback)
+ */
+template<typename T>
+struct With {};
+
+/**
+ * @brief Query term: entity must not have T
+ */
+template<typename T>
+struct Without {};
+
+/**
+ * @brief Query term: T is passed if present (as pointer / possibly empty span)
+ */
+template<typename T>
+struct Optional {};
+
+namespace detail {
+
+/**
+ * @brief How a query term participates in matching and iteration
+ */
+enum class TermKind : u8 {
+    REQUIRED,  ///< Must be present, passed to callback
+    OPTIONAL,  ///< May be absent, passed to callback
+    WITH,  ///< Must be present, not passed
+    WITHOUT,  ///< Must be absent, not passed
+};
+
+/**
+ * @brief Decompose a query term into kind + (possibly const) component type
+ */
+template<typename T>
+struct QueryTerm {
+    static constexpr TermKind kind = TermKind::REQUIRED;
+    using value_type = T;
+};
+
+template<typename T>
+struct QueryTerm<Optional<T>> {
+    static constexpr TermKind kind = TermKind::OPTIONAL;
+    using value_type = T;
+};
+
+template<typename T>
+struct QueryTerm<With<T>> {
+    static constexpr TermKind kind = TermKind::WITH;
+    using value_type = T;
+};
+
+template<typename T>
+struct QueryTerm<Without<T>> {
+    static constexpr TermKind kind = TermKind::WITHOUT;
+    using value_type = T;
+};
+
+/**
+ * @brief Per-chunk column of a passed term
+ * 
+ * Wraps the column span and knows how to hand out one element: a reference
+ * for required terms, a pointer (nullptr if the archetype lacks T) for
+ * optional ones.
+ */
+template<typename Term>
+struct TermColumn {
+    using value_type = typename QueryTerm<Term>::value_type;
+    static constexpr bool is_optional = QueryTerm<Term>::kind == TermKind::OPTIONAL;
+    
+    std::span<value_type> column;  ///< Column of the current chunk (empty for absent optionals)
+    
+    [[nodiscard]] auto at(std::size_t row) const
+        -> std::conditional_t<is_optional, value_type*, value_type&> {
+        if constexpr (is_optional) {
+            return column.empty() ? nullptr : &column[row];
+        } else {
+            return column[row];
+        }
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Persistent query over entities matching a set of terms
+ * 
+ * ⚠️ IMPURE CLASS (caches matching archetypes)
+ * 
+ * **Performance Characteristics**:
+ * - Matching: once per archetype over the query's lifetime (incremental)
+ * - Iteration: matched archetypes only, chunk by chunk (no signature tests)
+ * - Sparse-set terms: per entity, O(smallest required sparse set)
+ * 
+ * @tparam Terms Query terms (T, const T, Optional<T>, With<T>, Without<T>)
+ */
+template<typename... Terms>
+class Query {
+public:
+    static_assert(sizeof...(Terms) > 0, "Query needs at least one term");
+    static_assert(!((is_tag_component_v<typename detail::QueryTerm<Terms>::value_type>
+                     && (detail::QueryTerm<Terms>::kind == detail::TermKind::REQUIRED
+                         || detail::QueryTerm<Terms>::kind == detail::TermKind::OPTIONAL)) || ...),
+                  "Tag components carry no data; use With<Tag> / Without<Tag>");
+    
+    /**
+     * @brief Create query bound to a world
+     * 
+     * ⚠️ IMPURE (may register component types)
+     * 
+     * @param world World to query (must outlive the query)
+     */
+    explicit Query(World& world)
+        : world_(&world)
+        , type_ids_{component_id<component_t<Terms>>()...} {
+        std::size_t term = 0;
+        ((add_term_to_signatures<Terms>(type_ids_[term++])), ...);
+    }
+    
+    /**
+     * @brief Iterate matching entities
+     * 
+     * ⚠️ IMPURE (allows mutation of non-const terms)
+     * 
+     * Callback receives the entity followed by one argument per passed term
+     * (T& for required terms, T* for Optional<T>).
+     * 
+     * @tparam Func Callback type
+     * @param func Callback invoked for each matching entity
+     */
+    template<typename Func>
+    auto each(Func&& func) -> void {
+        if constexpr (has_sparse) {
+            world_->visit_matching(required_, excluded_, sparse_required_, sparse_excluded_,
+                                   [&](Entity entity, u32 archetype_index, u32 row) {
+                [&]<std::size_t... I>(std::index_sequence<I...>) {
+                    std::apply([&](auto&&... args) {
+                        func(entity, args...);
+                    }, std::tuple_cat(term_args<I>(entity, archetype_index, row)...));
+                }(std::index_sequence_for<Terms...>{});
+            });
+            return;
+        }
+        
+        for_each_chunk([&](const Chunk& chunk, const auto& columns) {
+            const auto entities = chunk.entities();
+            std::apply([&](const auto&... term_columns) {
+                for (std::size_t i = 0; i < entities.size(); ++i) {
+                    func(entities[i], term_columns.at(i)...);
+                }
+            }, columns);
+        });
+    }
+    
+    /**
+     * @brief Iterate matching chunks
+     * 
+     * ⚠️ IMPURE (allows mutation of non-const terms)
+     * 
+     * Callback receives the chunk's entity span followed by one span per
+     * passed term (empty span for an Optional<T> the chunk lacks).
+     * 
+     * @tparam Func Callback type
+     * @param func Callback invoked for each matching chunk
+     */
+    template<typename Func>
+    auto each_chunk(Func&& func) -> void {
+        static_assert(!has_sparse, "Chunk iteration covers archetype columns only; use each() for sparse-set terms");
+        for_each_chunk([&](const Chunk& chunk, const auto& columns) {
+            std::apply([&](const auto&... term_columns) {
+                func(chunk.entities(), term_columns.column...);
+            }, columns);
+        });
+    }
+    
+    /**
+     * @brief Count matching entities
+     * 
+     * ⚠️ IMPURE (refreshes cache)
+     * 
+     * @return Number of entities the query would visit
+     */
+    [[nodiscard]] auto size() -> std::size_t {
+        if constexpr (has_sparse) {
+            std::size_t total = 0;
+            world_->visit_matching(required_, excluded_, sparse_required_, sparse_excluded_,
+                                   [&](Entity, u32, u32) { ++total; });
+            return total;
+        }
+        
+        refresh();
+        std::size_t total = 0;
+        for (const auto index : matched_) {
+            total += world_->archetype(index).size();
+        }
+        return total;
+    }
+    
+    /**
+     * @brief Get indices of matching archetypes
+     * 
+     * ⚠️ IMPURE (refreshes cache)
+     * 
+     * Only table terms are considered (sparse-set terms are checked per entity).
+     * 
+     * @return Archetype indices (in creation order)
+     */
+    [[nodiscard]] auto archetypes() -> std::span<const u32> {
+        refresh();
+        return matched_;
+    }
+    
+    /**
+     * @brief Match archetypes created since the last refresh
+     * 
+     * ⚠️ IMPURE (updates cache)
+     * 
+     * Called automatically by every iteration; O(new archetypes).
+     */
+    auto refresh() -> void {
+        if (epoch_ != world_->archetype_epoch()) {
+            matched_.clear();
+            scanned_ = 0;
+            epoch_ = world_->archetype_epoch();
+        }
+        
+        for (; scanned_ < world_->archetype_count(); ++scanned_) {
+            const auto& signature = world_->archetype(scanned_).signature();
+            if (signature.contains(required_) && !signature.intersects(excluded_)) {
+                matched_.push_back(static_cast<u32>(scanned_));
+            }
+        }
+    }
+
+private:
+    template<typename Term>
+    using component_t = std::remove_const_t<typename detail::QueryTerm<Term>::value_type>;
+    
+    static constexpr bool has_sparse = (is_sparse_component_v<component_t<Terms>> || ...);
+    
+    template<typename Term>
+    static constexpr bool is_passed = detail::QueryTerm<Term>::kind == detail::TermKind::REQUIRED
+                                   || detail::QueryTerm<Term>::kind == detail::TermKind::OPTIONAL;
+    
+    /**
+     * @brief Record a term in the required / excluded signatures
+     */
+    template<typename Term>
+    auto add_term_to_signatures(u32 type_id) -> void {
+        constexpr auto kind = detail::QueryTerm<Term>::kind;
+        constexpr bool sparse = is_sparse_component_v<component_t<Term>>;
+        if constexpr (kind == detail::TermKind::REQUIRED || kind == detail::TermKind::WITH) {
+            sparse ? sparse_required_.push_back(type_id) : void(required_.set(type_id));
+        } else if constexpr (kind == detail::TermKind::WITHOUT) {
+            sparse ? sparse_excluded_.push_back(type_id) : void(excluded_.set(type_id));
+        }
+    }
+    
+    /**
+     * @brief Callback arguments of one term for a located entity (sparse-aware path)
+     */
+    template<std::size_t I>
+    auto term_args(Entity entity, u32 archetype_index, u32 row) const {
+        using Term = std::tuple_element_t<I, std::tuple<Terms...>>;
+        using Value = typename detail::QueryTerm<Term>::value_type;
+        constexpr auto kind = detail::QueryTerm<Term>::kind;
+        if constexpr (kind == detail::TermKind::REQUIRED) {
+            return std::tuple<Value&>{*world_->template fetch<Value>(type_ids_[I], entity, archetype_index, row)};
+        } else if constexpr (kind == detail::TermKind::OPTIONAL) {
+            return std::tuple<Value*>{world_->template fetch<Value>(type_ids_[I], entity, archetype_index, row)};
+        } else {
+            return std::tuple<>{};
+        }
+    }
+    
+    /**
+     * @brief Columns of one term in a chunk (empty tuple for filter-only terms)
+     */
+    template<std::size_t I>
+    auto term_columns(Chunk& chunk) const {
+        using Term = std::tuple_element_t<I, std::tuple<Terms...>>;
+        if constexpr (is_passed<Term>) {
+            if constexpr (!std::is_const_v<typename detail::QueryTerm<Term>::value_type>) {
+                chunk.mark_column_changed(type_ids_[I], world_->change_tick());  // Writable term counts as a write
+            }
+            return std::tuple<detail::TermColumn<Term>>{{chunk.column<component_t<Term>>(type_ids_[I])}};
+        } else {
+            return std::tuple<>{};
+        }
+    }
+    
+    /**
+     * @brief Visit every chunk of every matching archetype with its term columns
+     */
+    template<typename Visitor>
+    auto for_each_chunk(Visitor&& visit) -> void {
+        refresh();
+        for (const auto index : matched_) {
+            auto& archetype = world_->archetype(index);
+            for (std::size_t c = 0; c < archetype.chunk_count(); ++c) {
+                Chunk& chunk = archetype.chunk(c);
+                [&]<std::size_t... I>(std::index_sequence<I...>) {
+                    visit(chunk, std::tuple_cat(term_columns<I>(chunk)...));
+                }(std::index_sequence_for<Terms...>{});
+            }
+        }
+    }
+    
+    World* world_;  ///< Queried world
+    std::array<u32, sizeof...(Terms)> type_ids_;  ///< Component type ID per term
+    ComponentSignature required_;  ///< Required components (plain terms + With<T>)
+    ComponentSignature excluded_;  ///< Excluded components (Without<T>)
+    std::vector<u32> sparse_required_;  ///< Required sparse-set components
+    std::vector<u32> sparse_excluded_;  ///< Excluded sparse-set components
+    
+    std::vector<u32> matched_;  ///< Indices of matching archetypes
+    std::size_t scanned_{0};  ///< Archetypes [0, scanned_) have been tested
+    u64 epoch_{0};  ///< World archetype epoch the cache was built against
+};
+
+} // namespace luma::scene
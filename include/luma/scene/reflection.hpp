@@ -0,0 +1,326 @@
+/**
+ * @file reflection.hpp
+ * @brief Compile-time field descriptions of components (name, offset, type)
+ * 
+ * A component describes its fields once, as a constexpr table; everything
+ * that needs to look inside a component without knowing its C++ type
+ * (YAML serializer, binary writer, migration between layout versions,
+ * editor inspectors) walks that table instead of hand-written code:
+ * 
+ * @code
+ * struct Paddle {
+ *     f32 speed{10.0f};
+ *     vec3 extents{0.5f, 3.0f, 0.5f};
+ * };
+ * 
+ * template<>
+ * struct luma::scene::ComponentFields<Paddle> {
+ *     static constexpr std::array fields{
+ *         LUMA_FIELD(Paddle, speed),
+ *         LUMA_FIELD(Paddle, extents),
+ *     };
+ * };
+ * 
+ * // registering a name attaches the table; the scene serializer picks it up
+ * ComponentRegistry::instance().register_component<Paddle>("Paddle");
+ * @endcode
+ * 
+ * The registry stores the table next to the type's ComponentTypeInfo, so
+ * ComponentRegistry::fields(type_id) is all a tool needs.
+ * 
+ * **Supported field types**: bool, u8, i32, u32, u64, f32, vec2, vec3,
+ * vec4, quat, std::string, and enums over u8/i32/u32 (optionally with
+ * enumerator names, see LUMA_ENUM_FIELD).
+ * 
+ * ✨ PURE DATA ✨ (tables are constexpr; helpers only touch the objects passed in)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/math.hpp>
+#include <luma/core/types.hpp>
+#include <luma/scene/component.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Storage type of a reflected field
+ */
+enum class FieldType : u8 {
+    BOOL,
+    U8,
+    I32,
+    U32,
+    U64,
+    F32,
+    VEC2,
+    VEC3,
+    VEC4,
+    QUAT,  ///< Stored as glm::quat; written (w, x, y, z)
+    STRING,  ///< std::string (the only non-trivially-copyable field type)
+};
+
+/**
+ * @brief Description of one component field
+ * 
+ * ✨ IMMUTABLE VALUE TYPE ✨
+ */
+struct FieldInfo {
+    std::string_view name;  ///< Field name (member name by default)
+    u32 offset{0};  ///< offsetof(Component, member)
+    FieldType type{FieldType::F32};  ///< Storage type
+    std::span<const std::string_view> enumerators{};  ///< Names of enum values (index = value), empty if not an enum
+};
+
+/**
+ * @brief Map a C++ member type to its FieldType
+ * 
+ * ✨ PURE FUNCTION ✨ (compile time only)
+ */
+template<typename T>
+consteval auto field_type_of() -> FieldType {
+    if constexpr (std::is_enum_v<T>) {
+        return field_type_of<std::underlying_type_t<T>>();
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return FieldType::BOOL;
+    } else if constexpr (std::is_same_v<T, u8>) {
+        return FieldType::U8;
+    } else if constexpr (std::is_same_v<T, i32>) {
+        return FieldType::I32;
+    } else if constexpr (std::is_same_v<T, u32>) {
+        return FieldType::U32;
+    } else if constexpr (std::is_same_v<T, u64>) {
+        return FieldType::U64;
+    } else if constexpr (std::is_same_v<T, f32>) {
+        return FieldType::F32;
+    } else if constexpr (std::is_same_v<T, vec2>) {
+        return FieldType::VEC2;
+    } else if constexpr (std::is_same_v<T, vec3>) {
+        return FieldType::VEC3;
+    } else if constexpr (std::is_same_v<T, vec4>) {
+        return FieldType::VEC4;
+    } else if constexpr (std::is_same_v<T, quat>) {
+        return FieldType::QUAT;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return FieldType::STRING;
+    } else {
+        static_assert(sizeof(T) == 0, "Unsupported reflected field type");
+        return FieldType::F32;
+    }
+}
+
+/**
+ * @brief Size in bytes of a field type's in-memory representation
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+[[nodiscard]] constexpr auto field_size(FieldType type) -> u32 {
+    switch (type) {
+        case FieldType::BOOL:
+        case FieldType::U8:
+            return 1;
+        case FieldType::I32:
+        case FieldType::U32:
+        case FieldType::F32:
+            return 4;
+        case FieldType::U64:
+        case FieldType::VEC2:
+            return 8;
+        case FieldType::VEC3:
+            return 12;
+        case FieldType::VEC4:
+        case FieldType::QUAT:
+            return 16;
+        case FieldType::STRING:
+            return sizeof(std::string);
+    }
+    return 0;
+}
+
+/**
+ * @brief Describe a member of a standard-layout component
+ */
+#define LUMA_FIELD(Type, member) \
+    ::luma::scene::FieldInfo{#member, static_cast<::luma::u32>(offsetof(Type, member)), \
+                             ::luma::scene::field_type_of<decltype(Type::member)>()}
+
+/**
+ * @brief Describe an enum member, with its enumerator names (array indexed by value)
+ */
+#define LUMA_ENUM_FIELD(Type, member, names) \
+    ::luma::scene::FieldInfo{#member, static_cast<::luma::u32>(offsetof(Type, member)), \
+                             ::luma::scene::field_type_of<decltype(Type::member)>(), names}
+
+/**
+ * @brief Field table of component type T (specialize to reflect a type)
+ * 
+ * The primary template describes no fields: the type is stored and
+ * migrated as usual but skipped by reflection-driven tools. Tag components
+ * need no table.
+ */
+template<typename T>
+struct ComponentFields {
+    static constexpr std::array<FieldInfo, 0> fields{};
+};
+
+/**
+ * @brief Field table of T as a span
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+template<typename T>
+[[nodiscard]] constexpr auto fields_of() -> std::span<const FieldInfo> {
+    return ComponentFields<std::remove_cvref_t<T>>::fields;
+}
+
+// ========== Built-in components ==========
+
+/**
+ * @brief SDFType enumerator names (index = value)
+ */
+inline constexpr std::array<std::string_view, 5> SDF_TYPE_NAMES{"Sphere", "Box", "Plane", "Capsule", "Torus"};
+
+template<>
+struct ComponentFields<Transform> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Transform, position),
+        LUMA_FIELD(Transform, rotation),
+        LUMA_FIELD(Transform, scale),
+    };
+};
+
+template<>
+struct ComponentFields<Geometry> {
+    static constexpr std::array fields{
+        LUMA_ENUM_FIELD(Geometry, type, SDF_TYPE_NAMES),
+        LUMA_FIELD(Geometry, params),
+        LUMA_FIELD(Geometry, rounding),
+    };
+};
+
+template<>
+struct ComponentFields<Material> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Material, base_color),
+        LUMA_FIELD(Material, metallic),
+        LUMA_FIELD(Material, roughness),
+        LUMA_FIELD(Material, emissive_color),
+        LUMA_FIELD(Material, ior),
+    };
+};
+
+template<>
+struct ComponentFields<Velocity> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Velocity, linear),
+    };
+};
+
+template<>
+struct ComponentFields<Name> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Name, value),
+    };
+};
+
+// ========== Generic field operations ==========
+
+/**
+ * @brief Check whether every field is trivially copyable
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+[[nodiscard]] constexpr auto fields_trivially_copyable(std::span<const FieldInfo> fields) -> bool {
+    for (const auto& field : fields) {
+        if (field.type == FieldType::STRING) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Find a field by name
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * @return Field, or nullptr if absent
+ */
+[[nodiscard]] auto find_field(std::span<const FieldInfo> fields, std::string_view name) -> const FieldInfo*;
+
+/**
+ * @brief Copy matching fields between two layouts of a component
+ * 
+ * ⚠️ IMPURE (writes dst)
+ * 
+ * Fields are matched by name; a field present in both with the same type
+ * is copied (memcpy for trivial fields, assignment for strings). Fields
+ * only in `to` keep their current value (construct dst with defaults
+ * first), fields only in `from` or with a changed type are dropped.
+ * 
+ * @param to Field table of the destination layout
+ * @param dst Constructed destination object
+ * @param from Field table of the source layout
+ * @param src Source object
+ * @return Number of fields copied
+ */
+auto migrate_fields(
+    std::span<const FieldInfo> to, void* dst,
+    std::span<const FieldInfo> from, const void* src
+) -> std::size_t;
+
+/**
+ * @brief Append the fields of an object in a compact binary form
+ * 
+ * ⚠️ IMPURE (appends to out)
+ * 
+ * Fields are written in table order, little-endian host layout, no
+ * padding; strings as a u32 byte length followed by the bytes.
+ * 
+ * @param fields Field table
+ * @param object Object to encode
+ * @param out Byte buffer to append to
+ */
+auto write_fields(std::span<const FieldInfo> fields, const void* object, std::vector<std::byte>& out) -> void;
+
+/**
+ * @brief Decode fields written by write_fields() into an object
+ * 
+ * ⚠️ IMPURE (writes object)
+ * 
+ * @param fields Field table (same as when written)
+ * @param object Constructed destination object
+ * @param in Encoded bytes
+ * @return Bytes consumed, or std::nullopt if `in` is truncated
+ */
+auto read_fields(std::span<const FieldInfo> fields, void* object, std::span<const std::byte> in)
+    -> std::optional<std::size_t>;
+
+/**
+ * @brief Size of one record written by write_fields(), without decoding it
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * Lets a loader validate a whole encoded stream before constructing
+ * anything from it.
+ * 
+ * @param fields Field table (same as when written)
+ * @param in Encoded bytes
+ * @return Bytes the record occupies, or std::nullopt if `in` is truncated
+ */
+auto measure_fields(std::span<const FieldInfo> fields, std::span<const std::byte> in)
+    -> std::optional<std::size_t>;
+
+} // namespace luma::scene
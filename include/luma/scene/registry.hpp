@@ -0,0 +1,264 @@
+/**
+ * @file registry.hpp
+ * @brief Component type registry for LUMA ECS
+ * 
+ * Assigns every component type a dense numeric ID and keeps its type-erased
+ * operations table (ComponentTypeInfo), so the World can store, migrate and
+ * destroy components of types it has never heard of at compile time.
+ * 
+ * **Hybrid ID assignment**:
+ * - Built-in components (Transform, Geometry, Material, Velocity, Name) have
+ *   fixed compile-time IDs 0-4 (stable across runs, usable in constexpr code)
+ * - Any other type gets the next free ID the first time component_id<T>() is
+ *   called (or explicitly via ComponentRegistry::register_component<T>())
+ * 
+ * Game code can therefore define its own components without touching world.hpp:
+ * @code
+ * struct Paddle { f32 speed{10.0f}; };
+ * 
+ * ComponentRegistry::instance().register_component<Paddle>("Paddle");  // optional (adds a name)
+ * world.add_component(entity, Paddle{});
+ * @endcode
+ * 
+ * ⚠️ IMPURE (process-wide registry, thread-safe)
+ * 
+ * Records live in fixed pages that never move once published, so the hot
+ * lookups (info(), fields()) are lock-free; registration and names take
+ * a mutex.
+ * 
+ * @note IDs of runtime-registered types depend on registration order; do not
+ *       persist them (serialize by name instead)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+#include <luma/scene/archetype.hpp>
+#include <luma/scene/component.hpp>
+#include <luma/scene/reflection.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Sentinel component type ID ("not a registered component")
+ */
+inline constexpr u32 INVALID_COMPONENT = static_cast<u32>(-1);
+
+/**
+ * @brief Compile-time IDs of the built-in components
+ * 
+ * Specialized for the components shipped in component.hpp; every other type
+ * maps to INVALID_COMPONENT and is assigned an ID at runtime.
+ * 
+ * @tparam T Component type
+ */
+template<typename T>
+struct BuiltinComponentId {
+    static constexpr u32 value = INVALID_COMPONENT;
+};
+
+template<> struct BuiltinComponentId<Transform> { static constexpr u32 value = 0; };
+template<> struct BuiltinComponentId<Geometry> { static constexpr u32 value = 1; };
+template<> struct BuiltinComponentId<Material> { static constexpr u32 value = 2; };
+template<> struct BuiltinComponentId<Velocity> { static constexpr u32 value = 3; };
+template<> struct BuiltinComponentId<Name> { static constexpr u32 value = 4; };
+
+/**
+ * @brief Number of built-in components (first runtime ID)
+ */
+inline constexpr u32 BUILTIN_COMPONENT_COUNT = 5;
+
+/**
+ * @brief Process-wide table of component types
+ * 
+ * Maps component type ID -> operations table + human readable name.
+ * 
+ * ⚠️ IMPURE CLASS (global mutable state, guarded by a mutex)
+ */
+class ComponentRegistry {
+public:
+    /**
+     * @brief Get the process-wide registry
+     * 
+     * ⚠️ IMPURE (initializes registry on first call)
+     * 
+     * @return Registry instance (built-in components already registered)
+     */
+    [[nodiscard]] static auto instance() -> ComponentRegistry&;
+    
+    /**
+     * @brief Get (and on first use assign) the ID of component type T
+     * 
+     * ⚠️ IMPURE (may register T)
+     * 
+     * Built-ins resolve at compile time; other types pay one static-local
+     * check per call after the first.
+     * 
+     * @tparam T Component type (cv/ref qualifiers ignored)
+     * @return Dense component type ID
+     */
+    template<typename T>
+    [[nodiscard]] static auto id() -> u32 {
+        using Component = std::remove_cvref_t<T>;
+        if constexpr (!std::is_same_v<T, Component>) {
+            return id<Component>();  // One ID (and one static) per unqualified type
+        } else if constexpr (BuiltinComponentId<Component>::value != INVALID_COMPONENT) {
+            return BuiltinComponentId<Component>::value;
+        } else {
+            static const u32 type_id = instance().register_type(ComponentTypeInfo::of<Component>(), fields_of<Component>());
+            return type_id;
+        }
+    }
+    
+    /**
+     * @brief Register component type T under a name
+     * 
+     * ⚠️ IMPURE (modifies registry)
+     * 
+     * Registration is idempotent; calling it only attaches a name (used by
+     * tools and serialization) to the ID that id<T>() would return anyway.
+     * The field table (ComponentFields<T>) is attached when the ID is assigned.
+     * 
+     * Names must be unique: loaders resolve components by name, so a name
+     * already held by another type is refused (logged, T keeps its old name).
+     * 
+     * @tparam T Component type
+     * @param name Unique display name
+     * @return Component type ID, or INVALID_COMPONENT if the name is taken
+     */
+    template<typename T>
+    auto register_component(std::string_view name) -> u32 {
+        const u32 type_id = id<T>();
+        return set_name(type_id, name) ? type_id : INVALID_COMPONENT;
+    }
+    
+    /**
+     * @brief Get operations table of a registered type
+     * 
+     * ✨ PURE FUNCTION ✨ (lock-free)
+     * 
+     * @param type_id Component type ID (must be registered)
+     * @return Operations table
+     */
+    [[nodiscard]] auto info(u32 type_id) const -> ComponentTypeInfo;
+    
+    /**
+     * @brief Get name of a registered type
+     * 
+     * ✨ PURE FUNCTION ✨ (under lock)
+     * 
+     * @param type_id Component type ID
+     * @return Name (empty if type was never named or ID unknown)
+     */
+    [[nodiscard]] auto name(u32 type_id) const -> std::string;
+    
+    /**
+     * @brief Get reflected fields of a registered type
+     * 
+     * ✨ PURE FUNCTION ✨ (lock-free; the table itself is static)
+     * 
+     * @param type_id Component type ID
+     * @return Field table (empty if T is not reflected or ID unknown)
+     */
+    [[nodiscard]] auto fields(u32 type_id) const -> std::span<const FieldInfo>;
+    
+    /**
+     * @brief Look up a type ID by name
+     * 
+     * ✨ PURE FUNCTION ✨ (under lock)
+     * 
+     * @param name Registered name
+     * @return Component type ID (INVALID_COMPONENT if not found)
+     */
+    [[nodiscard]] auto find(std::string_view name) const -> u32;
+    
+    /**
+     * @brief Get number of registered component types
+     * 
+     * ✨ PURE FUNCTION ✨ (lock-free)
+     * 
+     * @return Count (IDs are 0..count-1)
+     */
+    [[nodiscard]] auto size() const -> u32;
+
+private:
+    static constexpr u32 PAGE_SIZE = 64;  ///< Records per page
+    static constexpr u32 MAX_PAGES = 1024;  ///< Page slots (caps the registry at 65536 types)
+    
+    /**
+     * @brief Entry of the registry
+     * 
+     * info and fields are written once, before the ID is handed out; name
+     * may change later and is only touched under the mutex.
+     */
+    struct Record {
+        ComponentTypeInfo info;  ///< Operations table
+        std::string name;  ///< Display name (may be empty)
+        std::span<const FieldInfo> fields;  ///< Reflected fields (static table, may be empty)
+    };
+    
+    ComponentRegistry();
+    
+    auto register_type(ComponentTypeInfo info, std::span<const FieldInfo> fields) -> u32;
+    auto set_name(u32 type_id, std::string_view name) -> bool;
+    
+    /**
+     * @brief Append a record (caller holds mutex_)
+     */
+    auto append(Record record) -> u32;
+    
+    /**
+     * @brief Record of a published type ID (no lock needed)
+     */
+    [[nodiscard]] auto record(u32 type_id) const -> Record& {
+        return pages_[type_id / PAGE_SIZE].load(std::memory_order_acquire)[type_id % PAGE_SIZE];
+    }
+    
+    mutable std::mutex mutex_;  ///< Guards registration and names
+    std::array<std::atomic<Record*>, MAX_PAGES> pages_{};  ///< Record pages, published once and never moved
+    std::vector<std::unique_ptr<Record[]>> owned_pages_;  ///< Storage behind pages_
+    std::atomic<u32> size_{0};  ///< Published records
+};
+
+/**
+ * @brief Get component type ID
+ * 
+ * ⚠️ IMPURE (may register T on first use)
+ * 
+ * @tparam T Component type
+ * @return Dense component type ID
+ */
+template<typename T>
+[[nodiscard]] inline auto component_id() -> u32 {
+    return ComponentRegistry::id<T>();
+}
+
+/**
+ * @brief Compute component signature for set of types
+ * 
+ * ⚠️ IMPURE (may register types on first use)
+ * 
+ * @tparam Components Component types
+ * @return Bitset signature
+ */
+template<typename... Components>
+[[nodiscard]] inline auto signature_of() -> ComponentSignature {
+    ComponentSignature signature;
+    (signature.set(component_id<Components>()), ...);
+    return signature;
+}
+
+} // namespace luma::scene
@@ -0,0 +1,168 @@
+/**
+ * @file relation.hpp
+ * @brief Entity relationship pairs (relation, target) with reverse index
+ * 
+ * A relation is any type R used as a label: `world.add_pair<ChildOf>(child,
+ * parent)` records the pair (ChildOf, parent) on child. Each relation type
+ * owns one RelationIndex holding both directions, so
+ * - "targets of source" (what does e collide with?) and
+ * - "sources of target" (all entities with ChildOf(X))
+ * are O(result) lookups instead of scans over every entity.
+ * 
+ * **Layout** (per relation type):
+ * @code
+ * targets_: source -> [target, target, ...]
+ * sources_: target -> [source, source, ...]
+ * @endcode
+ * 
+ * Relations declared exclusive (`static constexpr bool exclusive_relation =
+ * true;`) hold at most one target per source: adding a new pair replaces the
+ * previous one, which is what ChildOf-style relations want.
+ * 
+ * Destroying an entity removes every pair it takes part in, as source or as
+ * target (World::destroy_entity does this).
+ * 
+ * ⚠️ IMPURE CLASS (owns pair bookkeeping)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+#include <luma/scene/entity.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Exclusive-relation trait (at most one target per source)
+ * 
+ * Reads `T::exclusive_relation` when present, defaults to false.
+ */
+template<typename T>
+struct RelationTraits {
+    static constexpr bool exclusive = [] {
+        if constexpr (requires { { T::exclusive_relation } -> std::convertible_to<bool>; }) {
+            return static_cast<bool>(T::exclusive_relation);
+        } else {
+            return false;
+        }
+    }();
+};
+
+template<typename T>
+inline constexpr bool is_exclusive_relation_v = RelationTraits<T>::exclusive;
+
+/**
+ * @brief Bidirectional pair index for one relation type
+ * 
+ * ⚠️ IMPURE CLASS (not thread-safe for writes)
+ */
+class RelationIndex {
+public:
+    /**
+     * @brief Create empty index
+     * 
+     * @param exclusive At most one target per source
+     */
+    explicit RelationIndex(bool exclusive)
+        : exclusive_(exclusive) {}
+    
+    /**
+     * @brief Add pair (source -> target)
+     * 
+     * ⚠️ IMPURE (replaces the previous target of an exclusive relation)
+     * 
+     * @param source Entity holding the relation
+     * @param target Entity the relation points at
+     * @return false if the pair already existed
+     */
+    auto add(Entity source, Entity target) -> bool;
+    
+    /**
+     * @brief Remove pair (source -> target)
+     * 
+     * ⚠️ IMPURE (modifies index)
+     * 
+     * @return true if the pair existed
+     */
+    auto remove(Entity source, Entity target) -> bool;
+    
+    /**
+     * @brief Remove every pair an entity takes part in (as source or target)
+     * 
+     * ⚠️ IMPURE (modifies index)
+     * 
+     * O(pairs of entity) (plus the partner lists they are erased from).
+     * 
+     * @param entity Entity being destroyed
+     */
+    auto erase_entity(Entity entity) -> void;
+    
+    /**
+     * @brief Remove all pairs
+     * 
+     * ⚠️ IMPURE (modifies index)
+     */
+    auto clear() -> void {
+        targets_.clear();
+        sources_.clear();
+        pair_count_ = 0;
+    }
+    
+    /**
+     * @brief Check for pair (source -> target)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto contains(Entity source, Entity target) const -> bool;
+    
+    /**
+     * @brief Get targets of a source
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Targets (unordered; invalidated by the next write)
+     */
+    [[nodiscard]] auto targets(Entity source) const -> std::span<const Entity> {
+        const auto it = targets_.find(source);
+        return it != targets_.end() ? std::span<const Entity>{it->second} : std::span<const Entity>{};
+    }
+    
+    /**
+     * @brief Get sources pointing at a target
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Sources (unordered; invalidated by the next write)
+     */
+    [[nodiscard]] auto sources(Entity target) const -> std::span<const Entity> {
+        const auto it = sources_.find(target);
+        return it != sources_.end() ? std::span<const Entity>{it->second} : std::span<const Entity>{};
+    }
+    
+    [[nodiscard]] auto pair_count() const -> std::size_t { return pair_count_; }
+    [[nodiscard]] auto is_exclusive() const -> bool { return exclusive_; }
+
+private:
+    /**
+     * @brief Remove one entity from a list in a map (drops the list when empty)
+     * 
+     * @return true if it was present
+     */
+    static auto unlink(std::unordered_map<Entity, std::vector<Entity>>& map, Entity key, Entity value) -> bool;
+    
+    std::unordered_map<Entity, std::vector<Entity>> targets_;  ///< Source -> targets
+    std::unordered_map<Entity, std::vector<Entity>> sources_;  ///< Target -> sources (reverse index)
+    std::size_t pair_count_{0};  ///< Number of pairs
+    bool exclusive_;  ///< At most one target per source
+};
+
+} // namespace luma::scene
@@ -0,0 +1,210 @@
+/**
+ * @file schedule.hpp
+ * @brief System scheduling with automatic read/write conflict analysis
+ * 
+ * Systems declare which components they read and write. The Schedule turns
+ * those declarations into a dependency DAG (two systems conflict if one
+ * writes a component the other reads or writes; the earlier-registered one
+ * runs first) and groups the systems into waves: every system in a wave is
+ * independent of the others, so a wave runs concurrently on the JobSystem.
+ * 
+ * Example:
+ * @code
+ * Schedule schedule;
+ * schedule.add_system("integrate", SystemAccess{}.read<Velocity>().write<Transform>(),
+ *                     [dt](World& w) { w.each<Transform, const Velocity>(...); });
+ * schedule.add_system("damping", SystemAccess{}.write<Velocity>(), ...);   // after integrate
+ * schedule.add_system("labels", SystemAccess{}.read<Name>(), ...);         // alongside integrate
+ * 
+ * schedule.run(world, jobs);  // wave 0: integrate + labels, wave 1: damping
+ * @endcode
+ * 
+ * **Contract**: a system touches only what it declares. Reading through a
+ * mutable span/reference counts as a write (it bumps change ticks), so
+ * read-only systems should iterate with const terms. Structural changes
+ * (spawn/destroy/add/remove) either require SystemAccess::exclusive() or go
+ * through a ThreadCommandBuffers applied after run().
+ * 
+ * ⚠️ IMPURE (runs user systems that mutate the world)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/jobs.hpp>
+#include <luma/core/types.hpp>
+#include <luma/scene/component.hpp>
+#include <luma/scene/registry.hpp>
+#include <luma/scene/world.hpp>
+
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Declared component access of a system
+ * 
+ * ✨ VALUE TYPE ✨ (builder-style setters)
+ */
+class SystemAccess {
+public:
+    /**
+     * @brief Declare read-only access to components
+     * 
+     * @tparam Components Component types
+     * @return *this
+     */
+    template<typename... Components>
+    auto read() -> SystemAccess& {
+        (reads_.set(component_id<Components>()), ...);
+        return *this;
+    }
+    
+    /**
+     * @brief Declare read-write access to components
+     * 
+     * @tparam Components Component types
+     * @return *this
+     */
+    template<typename... Components>
+    auto write() -> SystemAccess& {
+        (writes_.set(component_id<Components>()), ...);
+        return *this;
+    }
+    
+    /**
+     * @brief Declare exclusive world access (structural changes)
+     * 
+     * Conflicts with every other system, so it runs alone in its wave.
+     * 
+     * @return *this
+     */
+    auto exclusive() -> SystemAccess& {
+        exclusive_ = true;
+        return *this;
+    }
+    
+    /**
+     * @brief Check whether two systems may not run concurrently
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param other Other system's access
+     * @return true on write/write, write/read or exclusive overlap
+     */
+    [[nodiscard]] auto conflicts_with(const SystemAccess& other) const -> bool {
+        return exclusive_ || other.exclusive_
+            || writes_.intersects(other.writes_)
+            || writes_.intersects(other.reads_)
+            || reads_.intersects(other.writes_);
+    }
+    
+    [[nodiscard]] auto reads() const -> const ComponentSignature& { return reads_; }
+    [[nodiscard]] auto writes() const -> const ComponentSignature& { return writes_; }
+    [[nodiscard]] auto is_exclusive() const -> bool { return exclusive_; }
+
+private:
+    ComponentSignature reads_;  ///< Components read
+    ComponentSignature writes_;  ///< Components written
+    bool exclusive_{false};  ///< Needs the whole world
+};
+
+/**
+ * @brief System callback
+ */
+using SystemFunction = std::function<void(World&)>;
+
+/**
+ * @brief Ordered set of systems executed in conflict-free parallel waves
+ * 
+ * ⚠️ IMPURE CLASS (owns systems, caches wave layout)
+ * 
+ * **Ordering**: conflicting systems always run in registration order;
+ * independent systems may run in any order (or concurrently).
+ */
+class Schedule {
+public:
+    /**
+     * @brief Register a system
+     * 
+     * ⚠️ IMPURE (invalidates wave layout)
+     * 
+     * @param name System name (diagnostics)
+     * @param access Declared component access
+     * @param function System body
+     * @return System index
+     */
+    auto add_system(std::string name, SystemAccess access, SystemFunction function) -> u32;
+    
+    /**
+     * @brief Run all systems, wave by wave, on the job system
+     * 
+     * ⚠️ IMPURE (runs systems concurrently)
+     * 
+     * Blocks until the last wave has finished. Single-system waves run on
+     * the calling thread (no job overhead).
+     * 
+     * @param world World passed to every system
+     * @param jobs Job system executing concurrent waves
+     */
+    auto run(World& world, JobSystem& jobs) -> void;
+    
+    /**
+     * @brief Run all systems serially in wave order (no job system)
+     * 
+     * ⚠️ IMPURE (runs systems)
+     * 
+     * @param world World passed to every system
+     */
+    auto run(World& world) -> void;
+    
+    /**
+     * @brief Get wave layout (system indices per wave)
+     * 
+     * ⚠️ IMPURE (rebuilds layout if systems were added)
+     * 
+     * @return Waves in execution order
+     */
+    [[nodiscard]] auto waves() -> std::span<const std::vector<u32>>;
+    
+    /**
+     * @brief Get direct dependencies of a system (earlier conflicting systems)
+     * 
+     * ⚠️ IMPURE (rebuilds layout if systems were added)
+     * 
+     * @param system System index
+     * @return Indices of systems that must finish first
+     */
+    [[nodiscard]] auto dependencies(u32 system) -> std::span<const u32>;
+    
+    [[nodiscard]] auto system_count() const -> u32 { return static_cast<u32>(systems_.size()); }
+    [[nodiscard]] auto system_name(u32 system) const -> std::string_view { return systems_[system].name; }
+
+private:
+    /**
+     * @brief Registered system
+     */
+    struct System {
+        std::string name;  ///< Diagnostics name
+        SystemAccess access;  ///< Declared access
+        SystemFunction function;  ///< Body
+        std::vector<u32> dependencies;  ///< Earlier conflicting systems (DAG edges)
+    };
+    
+    /**
+     * @brief Build DAG edges and waves (longest path from a root)
+     */
+    auto build() -> void;
+    
+    std::vector<System> systems_;  ///< Systems in registration order
+    std::vector<std::vector<u32>> waves_;  ///< Cached wave layout
+    bool dirty_{false};  ///< Layout needs rebuild
+};
+
+} // namespace luma::scene
@@ -3,8 +3,24 @@
  * @brief Scene serialization to/from YAML format
  * 
  * Provides functions for saving and loading ECS scenes to human-readable
- * YAML files. Supports all core components (Transform, Geometry, Material,
- * Velocity, Name) with automatic serialization.
+ * YAML files. Every component type that has a registry name and a field
+ * table (see reflection.hpp) is serialized automatically: the built-ins
+ * (Transform, Geometry, Material, Velocity, Name) and any game component
+ * registered with ComponentRegistry::register_component<T>(name). Named
+ * tag components are written as empty maps.
+ * 
+ * **Versions**: files are written as version 2 (one map of fields per
+ * component). Version-1 files (hand-written Geometry/Material layouts) are
+ * still read and upgraded on load.
+ * 
+ * **Large scenes**: load_scene() builds the whole YAML tree before creating
+ * any entity. SceneStreamLoader parses on a background thread and hands over
+ * one entity at a time, so memory stays bounded and loading can be spread
+ * over frames. load_scene_parallel() decodes entities on the JobSystem.
+ * 
+ * **Autosave**: SceneJournal keeps a full scene file plus an append-only
+ * journal of deltas (what changed since the previous save), compacting the
+ * journal back into the scene file now and then.
  * 
  * ✨ FUNCTIONAL DESIGN ✨
  * - Pure functions where possible
@@ -22,12 +38,17 @@
 
 #pragma once
 
+#include <luma/core/jobs.hpp>
 #include <luma/core/types.hpp>
 #include <luma/scene/world.hpp>
 
+#include <cstddef>
 #include <expected>
 #include <filesystem>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace luma::scene {
 
@@ -42,6 +63,9 @@ enum class SerializationError {
     INVALID_COMPONENT_DATA,   ///< Component data is malformed
     MISSING_REQUIRED_FIELD,   ///< Required YAML field missing
     UNSUPPORTED_VERSION,      ///< Scene file version mismatch
+    CORRUPT_FILE,             ///< Binary scene truncated or inconsistent
+    COMPONENT_LAYOUT_MISMATCH, ///< Binary scene written for a different component layout
+    UNKNOWN_FILE_FORMAT,      ///< File extension is not a known scene format
 };
 
 /**
@@ -50,7 +74,8 @@ enum class SerializationError {
  * ✨ FUNCTIONAL (but has I/O side effects) ✨
  * 
  * Serializes all entities and their components to human-readable YAML.
- * Resulting file can be edited manually and hot-reloaded.
+ * Resulting file can be edited manually and hot-reloaded. Entities without
+ * any serializable component are not written.
  * 
  * @param world ECS world to serialize
  * @param path Output file path (will be created/overwritten)
@@ -92,7 +117,9 @@ auto save_scene(
  * @post world is cleared and repopulated with loaded data
  * 
  * @note All entities in World are destroyed before loading
- * @note Unknown component types are skipped with warning
+ * @note Unknown component types are skipped with warning (register game
+ *       components by name before loading)
+ * @note Fields missing from the file keep their default value
  * 
  * example:
  * @code
@@ -112,6 +139,260 @@ auto load_scene(
     const std::filesystem::path& path
 ) -> std::expected<void, SerializationError>;
 
+/**
+ * @brief Incremental YAML scene loader with bounded memory
+ * 
+ * ⚠️ IMPURE CLASS (owns a parser thread, modifies the target world)
+ * 
+ * A background thread runs yaml-cpp's event parser over the file and cuts
+ * the `entities` sequence into one YAML::Node per entity; at most
+ * `max_pending` of them are buffered (the parser blocks when the buffer is
+ * full). step() creates entities from whatever has been parsed, so a game
+ * loop can load a huge scene a batch per frame without a memory spike.
+ * 
+ * The world is cleared by the first step() that sees a valid `version`; a
+ * parse error later in the file leaves the entities loaded so far in the
+ * world. Memory stays bounded when `version` precedes `entities` (as
+ * save_scene() writes it); if it follows them, the entities are buffered
+ * until it is read.
+ * 
+ * example:
+ * @code
+ * SceneStreamLoader loader(world, "scenes/huge.yaml");
+ * // once per frame:
+ * if (auto done = loader.step(2000); !done) {
+ *     LOG_ERROR("Load failed: {}", error_to_string(done.error()));
+ * } else if (*done) {
+ *     // scene ready
+ * }
+ * @endcode
+ */
+class SceneStreamLoader {
+public:
+    /**
+     * @brief Open a scene and start parsing it in the background
+     * 
+     * @param world World to populate (must outlive the loader)
+     * @param path Input file path (errors are reported by step())
+     * @param max_pending Parsed entities buffered ahead of step()
+     */
+    SceneStreamLoader(World& world, const std::filesystem::path& path, std::size_t max_pending = 1024);
+    
+    /**
+     * @brief Stop the parser thread (abandons an unfinished load)
+     */
+    ~SceneStreamLoader();
+    
+    SceneStreamLoader(const SceneStreamLoader&) = delete;
+    SceneStreamLoader& operator=(const SceneStreamLoader&) = delete;
+    
+    /**
+     * @brief Create up to `max_entities` parsed entities
+     * 
+     * ⚠️ IMPURE (modifies world)
+     * 
+     * Waits only if nothing is parsed yet.
+     * 
+     * @param max_entities Batch size
+     * @return true once the whole scene is loaded, false if more remains,
+     *         or the error that ended the load
+     */
+    auto step(std::size_t max_entities) -> std::expected<bool, SerializationError>;
+    
+    /**
+     * @brief Number of entities created so far
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto loaded_count() const -> std::size_t { return loaded_count_; }
+
+private:
+    struct Impl;
+    
+    World& world_;  ///< Target world
+    std::unique_ptr<Impl> impl_;  ///< Parser thread and its queue
+    std::size_t loaded_count_{0};  ///< Entities created so far
+};
+
+/**
+ * @brief Load a scene through SceneStreamLoader in one call
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * Same result as load_scene() at bounded peak memory; YAML anchors and
+ * aliases are not supported.
+ * 
+ * @param world World to populate (cleared first)
+ * @param path Input file path
+ * @param batch_size Entities buffered / created per step
+ * @return Success (void) or error code
+ */
+auto load_scene_streaming(
+    World& world,
+    const std::filesystem::path& path,
+    std::size_t batch_size = 1024
+) -> std::expected<void, SerializationError>;
+
+/**
+ * @brief Load a scene, decoding entities in parallel on the JobSystem
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * The file is parsed once on the calling thread into one node per entity;
+ * the entity list is then split into ranges, each decoded by a job into its
+ * own staging buffer, and the world is built in a single batched pass
+ * (runs of same-archetype entities are spawned column by column). Decoding
+ * never touches the world, so any error leaves it unchanged.
+ * 
+ * Same result as load_scene(); entities are created in file order.
+ * 
+ * @param world World to populate (cleared first)
+ * @param path Input file path
+ * @param jobs Job system to decode on
+ * @return Success (void) or error code
+ */
+auto load_scene_parallel(
+    World& world,
+    const std::filesystem::path& path,
+    JobSystem& jobs
+) -> std::expected<void, SerializationError>;
+
+/**
+ * @brief What SceneJournal::save() wrote
+ */
+enum class JournalWrite : u8 {
+    FULL,  ///< Whole scene rewritten (first save or compaction), journal emptied
+    DELTA,  ///< Changes since the previous save appended to the journal
+    UNCHANGED,  ///< Nothing changed since the previous save, nothing written
+};
+
+/**
+ * @brief Compaction thresholds of a SceneJournal
+ */
+struct JournalOptions {
+    std::size_t max_deltas{64};  ///< Compact once this many deltas are journaled
+    double max_journal_ratio{0.5};  ///< ... or once the journal would outgrow this fraction of the scene file
+};
+
+/**
+ * @brief Incremental scene saving: a full scene file plus an append-only
+ * journal of deltas
+ * 
+ * ⚠️ IMPURE CLASS (file I/O, remembers the last saved state)
+ * 
+ * The first save() writes the whole scene. Later saves append one YAML
+ * document to `<path>.journal` holding only what changed since the previous
+ * save: entities that were added or destroyed, components that were added
+ * or removed, and components written since then (per-component change
+ * ticks, see World::component_tick_by_id()). Cost is a scan of the entity
+ * list plus emitting the changes, instead of re-emitting the whole world.
+ * 
+ * When the journal grows past JournalOptions the scene is compacted: fully
+ * rewritten (via a temporary file and rename) and the journal emptied.
+ * Each base file carries a fresh epoch that its deltas repeat, so deltas
+ * left over from an interrupted compaction are ignored on load. Deltas are
+ * numbered from 1 within an epoch and end with an `end: <number>` line;
+ * a delta torn by a crash mid-append lacks it and is ignored, and replay
+ * stops at the first missing number.
+ * 
+ * A journal follows one World: pass the same world to every save(). Like
+ * World::snapshot(), a save starts a new change tick, so a write made any
+ * time after it (even within the same frame) is part of the next delta.
+ * 
+ * example:
+ * @code
+ * SceneJournal autosave("autosave/level.yaml");
+ * // every few seconds:
+ * autosave.save(world);
+ * 
+ * // after a crash / on reopen:
+ * load_scene_journal(world, "autosave/level.yaml");
+ * @endcode
+ */
+class SceneJournal {
+public:
+    /**
+     * @brief Create a journal for a scene file (nothing is written yet)
+     * 
+     * @param path Scene file; the journal lives at `<path>.journal`
+     * @param options Compaction thresholds
+     */
+    explicit SceneJournal(std::filesystem::path path, JournalOptions options = {});
+    
+    /**
+     * @brief Save the world, as a delta when possible
+     * 
+     * ⚠️ IMPURE (file I/O, starts a new change tick)
+     * 
+     * @param world World to save (the same one every time)
+     * @return What was written, or error code
+     */
+    auto save(World& world) -> std::expected<JournalWrite, SerializationError>;
+    
+    /**
+     * @brief Rewrite the whole scene file and empty the journal
+     * 
+     * ⚠️ IMPURE (file I/O, starts a new change tick)
+     * 
+     * @param world World to save
+     * @return Success (void) or error code
+     */
+    auto compact(World& world) -> std::expected<void, SerializationError>;
+    
+    /**
+     * @brief Path of the journal file (`<scene path>.journal`)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto journal_path() const -> std::filesystem::path;
+    
+    /**
+     * @brief Number of deltas in the journal since the last compaction
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto delta_count() const -> std::size_t { return delta_count_; }
+
+private:
+    /**
+     * @brief Entity as of the last save
+     */
+    struct SavedEntity {
+        Entity entity;  ///< Handle (detects a reused ID)
+        std::vector<u32> types;  ///< Serializable component type IDs, ascending
+    };
+    
+    /**
+     * @brief Record which serializable components every entity has
+     */
+    [[nodiscard]] static auto capture(const World& world) -> std::unordered_map<u32, SavedEntity>;
+    
+    std::filesystem::path path_;  ///< Scene file
+    JournalOptions options_;  ///< Compaction thresholds
+    std::unordered_map<u32, SavedEntity> saved_;  ///< By entity ID, as of the last save
+    u32 saved_tick_{0};  ///< Last world change tick covered by a save (later writes are newer)
+    u64 epoch_{0};  ///< Epoch of the current base file (0: nothing saved yet)
+    std::size_t delta_count_{0};  ///< Deltas since the last compaction
+    std::uintmax_t scene_bytes_{0};  ///< Size of the base file
+    std::uintmax_t journal_bytes_{0};  ///< Size of the journal
+};
+
+/**
+ * @brief Load a scene file and replay its journal
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * Same as load_scene() for a scene without a journal.
+ * 
+ * @param world World to populate (cleared first)
+ * @param path Scene file written by SceneJournal
+ * @return Success (void) or error code
+ */
+auto load_scene_journal(
+    World& world,
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError>;
+
 /**
  * @brief Converts error code to human-readable string
  * 
@@ -144,6 +425,12 @@ constexpr auto error_to_string(SerializationError error) noexcept -> const char*
             return "Required field missing in YAML";
         case SerializationError::UNSUPPORTED_VERSION:
             return "Unsupported scene file version";
+        case SerializationError::CORRUPT_FILE:
+            return "Scene file is truncated or corrupt";
+        case SerializationError::COMPONENT_LAYOUT_MISMATCH:
+            return "Component layout changed since the scene was written";
+        case SerializationError::UNKNOWN_FILE_FORMAT:
+            return "Unknown scene file format";
         default:
             return "Unknown error";
     }
@@ -0,0 +1,108 @@
+/**
+ * @file snapshot.hpp
+ * @brief Immutable world snapshots for rollback and double-buffered simulation
+ * 
+ * World::snapshot() copies every archetype chunk into an immutable page
+ * with the chunk's own layout: columns of trivially copyable components are
+ * a single memcpy each, other components are copy-constructed row by row.
+ * World::restore() rebuilds a world (the same one or another) from a
+ * snapshot the same way.
+ * 
+ * **Copy-on-write pages**: a snapshot shares every page whose chunk was not
+ * written since the previous snapshot of the same world (same archetype,
+ * same rows, no newer change tick), so a frame that moved a few entities
+ * copies only the chunks they live in. Pages are never modified, so
+ * snapshots (and copies of a WorldSnapshot handle) can be read from any
+ * thread while the world keeps simulating.
+ * 
+ * Example (rollback):
+ * @code
+ * std::deque<WorldSnapshot> history;
+ * history.push_back(*world.snapshot());     // every frame
+ * 
+ * world.restore(history[confirmed_frame]);  // late input arrived
+ * resimulate(world, confirmed_frame, current_frame);
+ * @endcode
+ * 
+ * Example (double buffer):
+ * @code
+ * auto frame = world.snapshot();           // simulation thread, end of frame N
+ * render_world.restore(*frame);            // render thread reads frame N
+ * @endcode
+ * 
+ * ✨ IMMUTABLE VALUE TYPE ✨ (cheap to copy: shares all storage)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace luma::scene {
+
+/**
+ * @brief Handle to an immutable copy of a World's state
+ * 
+ * ✨ IMMUTABLE VALUE TYPE ✨
+ * 
+ * A default-constructed snapshot is empty; restoring it clears the world.
+ */
+class WorldSnapshot {
+public:
+    struct Data;  ///< Opaque captured state (defined in snapshot.cpp)
+    
+    WorldSnapshot() = default;
+    
+    /**
+     * @brief Check whether this handle holds a snapshot
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto empty() const -> bool {
+        return !data_;
+    }
+    
+    /**
+     * @brief Get number of alive entities captured
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto entity_count() const -> std::size_t;
+    
+    /**
+     * @brief Get world change tick at capture time
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto tick() const -> u32;
+    
+    /**
+     * @brief Get number of chunk pages in the snapshot
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto page_count() const -> std::size_t;
+    
+    /**
+     * @brief Get number of pages shared with the previous snapshot (not copied)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto shared_page_count() const -> std::size_t;
+
+private:
+    friend class World;
+    
+    explicit WorldSnapshot(std::shared_ptr<const Data> data)
+        : data_(std::move(data)) {}
+    
+    std::shared_ptr<const Data> data_;  ///< Shared immutable state
+};
+
+} // namespace luma::scene
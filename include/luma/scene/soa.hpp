@@ -0,0 +1,192 @@
+/**
+ * @file soa.hpp
+ * @brief Field views and SoA lanes for vectorized ECS kernels
+ * 
+ * Chunk storage is SoA per component type (all Transforms contiguous), but
+ * each component is still a struct: Transform::position is a vec3 every
+ * sizeof(Transform) bytes. These helpers bridge that gap for SIMD kernels:
+ * 
+ * - StridedSpan<T>: view of one field across a component column (no copy)
+ * - Vec3Lanes: gathers a vec3 field into separate x[], y[], z[] arrays,
+ *   which compilers vectorize (AVX2: 8 lanes per op), then scatters back
+ * 
+ * Example (integrate one chunk):
+ * @code
+ * Vec3Lanes pos, vel;  // reused across chunks (no per-chunk allocation)
+ * world.each_chunk<Transform, const Velocity>([&](auto, std::span<Transform> transforms,
+ *                                                 std::span<const Velocity> velocities) {
+ *     pos.gather(field_view(transforms, &Transform::position));
+ *     vel.gather(field_view(velocities, &Velocity::linear));
+ *     for (std::size_t i = 0; i < pos.size(); ++i) {  // three contiguous float streams
+ *         pos.x()[i] += vel.x()[i] * dt;
+ *         pos.y()[i] += vel.y()[i] * dt;
+ *         pos.z()[i] += vel.z()[i] * dt;
+ *     }
+ *     pos.scatter(field_view(transforms, &Transform::position));
+ * });
+ * @endcode
+ * 
+ * @note Gather/scatter work on one chunk (<= 16 KiB of source data), so the
+ *       lanes stay cache resident
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/math.hpp>
+#include <luma/core/types.hpp>
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Non-owning view of elements spaced a fixed number of bytes apart
+ * 
+ * ✨ VALUE TYPE ✨ (view; does not own memory)
+ * 
+ * @tparam T Element type (const-qualified for read-only views)
+ */
+template<typename T>
+class StridedSpan {
+public:
+    using byte_type = std::conditional_t<std::is_const_v<T>, const std::byte, std::byte>;
+    
+    StridedSpan() = default;
+    
+    /**
+     * @brief View count elements starting at first, stride bytes apart
+     * 
+     * @param first Pointer to element 0
+     * @param count Number of elements
+     * @param stride Distance between elements in bytes
+     */
+    StridedSpan(T* first, std::size_t count, std::size_t stride)
+        : data_(reinterpret_cast<byte_type*>(first))
+        , size_(count)
+        , stride_(stride) {}
+    
+    /**
+     * @brief Implicit conversion to a read-only view
+     */
+    template<typename U>
+        requires std::is_same_v<const U, T> && (!std::is_same_v<U, T>)
+    StridedSpan(const StridedSpan<U>& other)  // NOLINT(google-explicit-constructor)
+        : StridedSpan(other.empty() ? nullptr : &other[0], other.size(), other.stride()) {}
+    
+    /**
+     * @brief Access element
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param index Element index (< size())
+     * @return Element reference
+     */
+    [[nodiscard]] auto operator[](std::size_t index) const -> T& {
+        return *reinterpret_cast<T*>(data_ + index * stride_);
+    }
+    
+    [[nodiscard]] auto size() const -> std::size_t { return size_; }
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+    [[nodiscard]] auto stride() const -> std::size_t { return stride_; }
+
+private:
+    byte_type* data_{nullptr};  ///< Address of element 0
+    std::size_t size_{0};  ///< Element count
+    std::size_t stride_{sizeof(T)};  ///< Bytes between elements
+};
+
+/**
+ * @brief View one field of every component in a column
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * @tparam Component Component type (const-qualified column -> read-only view)
+ * @tparam Field Field type
+ * @param components Component column (e.g. from World::each_chunk)
+ * @param field Pointer to member (e.g. &Transform::position)
+ * @return Strided view over the field
+ */
+template<typename Component, typename Field>
+[[nodiscard]] auto field_view(std::span<Component> components, Field std::remove_const_t<Component>::* field)
+    -> StridedSpan<std::conditional_t<std::is_const_v<Component>, const Field, Field>> {
+    if (components.empty()) {
+        return {};
+    }
+    return {&(components.front().*field), components.size(), sizeof(Component)};
+}
+
+/**
+ * @brief vec3 values split into x[], y[], z[] float arrays
+ * 
+ * ⚠️ IMPURE CLASS (owns scratch buffers, reused between gathers)
+ */
+class Vec3Lanes {
+public:
+    /**
+     * @brief Copy a vec3 field into the lanes (replaces previous contents)
+     * 
+     * ⚠️ IMPURE (writes lanes, may grow buffers)
+     * 
+     * @param source Values to split
+     */
+    auto gather(StridedSpan<const vec3> source) -> void {
+        resize(source.size());
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            const vec3& value = source[i];
+            x_[i] = value.x;
+            y_[i] = value.y;
+            z_[i] = value.z;
+        }
+    }
+    
+    /**
+     * @brief Write the lanes back into a vec3 field
+     * 
+     * ⚠️ IMPURE (writes target)
+     * 
+     * @param target Destination (size must equal size())
+     */
+    auto scatter(StridedSpan<vec3> target) const -> void {
+        for (std::size_t i = 0; i < target.size() && i < size_; ++i) {
+            target[i] = vec3(x_[i], y_[i], z_[i]);
+        }
+    }
+    
+    /**
+     * @brief Resize lanes (keeps capacity, values unspecified after growth)
+     * 
+     * ⚠️ IMPURE (may allocate)
+     * 
+     * @param count Number of elements
+     */
+    auto resize(std::size_t count) -> void {
+        if (count > x_.size()) {
+            x_.resize(count);
+            y_.resize(count);
+            z_.resize(count);
+        }
+        size_ = count;
+    }
+    
+    [[nodiscard]] auto x() -> std::span<f32> { return {x_.data(), size_}; }
+    [[nodiscard]] auto y() -> std::span<f32> { return {y_.data(), size_}; }
+    [[nodiscard]] auto z() -> std::span<f32> { return {z_.data(), size_}; }
+    [[nodiscard]] auto x() const -> std::span<const f32> { return {x_.data(), size_}; }
+    [[nodiscard]] auto y() const -> std::span<const f32> { return {y_.data(), size_}; }
+    [[nodiscard]] auto z() const -> std::span<const f32> { return {z_.data(), size_}; }
+    [[nodiscard]] auto size() const -> std::size_t { return size_; }
+
+private:
+    std::vector<f32> x_;  ///< X components
+    std::vector<f32> y_;  ///< Y components
+    std::vector<f32> z_;  ///< Z components
+    std::size_t size_{0};  ///< Live element count (buffers may be larger)
+};
+
+} // namespace luma::scene
@@ -0,0 +1,225 @@
+/**
+ * @file sparse_set.hpp
+ * @brief Sparse-set component storage for LUMA ECS
+ * 
+ * Components declared with StoragePolicy::SPARSE live outside the archetype
+ * chunks, one SparseSet per type. Adding or removing such a component never
+ * migrates the entity between archetypes, which makes them the right choice
+ * for flags toggled every few frames (hit markers, selection, timers).
+ * 
+ * **Layout**:
+ * @code
+ * sparse (paged): entity ID -> dense index   [page 0: 4096 slots][page 1]...
+ * dense:          Entity x N | Component x N | tick x N   (packed, swap-pop)
+ * @endcode
+ * 
+ * Pages are allocated on first use, so a set holding a few components of
+ * high-ID entities stays small. Lookups are two array reads.
+ * 
+ * ⚠️ IMPURE CLASS (owns component memory)
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#pragma once
+
+#include <luma/core/types.hpp>
+#include <luma/scene/archetype.hpp>
+#include <luma/scene/entity.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace luma::scene {
+
+/**
+ * @brief Type-erased sparse set (entity ID -> packed component)
+ * 
+ * ⚠️ IMPURE CLASS (owns components, not thread-safe for writes)
+ */
+class SparseSet {
+public:
+    static constexpr u32 PAGE_SIZE = 4096;  ///< Sparse slots per page
+    static constexpr u32 ABSENT = static_cast<u32>(-1);  ///< Sparse slot value for "no component"
+    
+    /**
+     * @brief Create empty set for one component type
+     * 
+     * @param type_id Component type ID
+     * @param info Operations table of the component type
+     */
+    SparseSet(u32 type_id, ComponentTypeInfo info);
+    
+    /**
+     * @brief Destructor (destroys all components)
+     */
+    ~SparseSet();
+    
+    // Non-copyable, non-movable (World holds sets by unique_ptr)
+    SparseSet(const SparseSet&) = delete;
+    SparseSet& operator=(const SparseSet&) = delete;
+    SparseSet(SparseSet&&) = delete;
+    SparseSet& operator=(SparseSet&&) = delete;
+    
+    /**
+     * @brief Get dense index of an entity's component
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param entity Entity handle (generation is checked)
+     * @return Dense index or ABSENT
+     */
+    [[nodiscard]] auto index_of(Entity entity) const -> u32 {
+        const u32 id = entity.id();
+        const u32 page = id / PAGE_SIZE;
+        if (page >= pages_.size() || !pages_[page]) {
+            return ABSENT;
+        }
+        const u32 index = pages_[page][id % PAGE_SIZE];
+        return index != ABSENT && entities_[index] == entity ? index : ABSENT;
+    }
+    
+    /**
+     * @brief Check whether an entity has this component
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto contains(Entity entity) const -> bool {
+        return index_of(entity) != ABSENT;
+    }
+    
+    /**
+     * @brief Get component of an entity
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param entity Entity handle
+     * @return Component pointer (nullptr if absent)
+     */
+    [[nodiscard]] auto get(Entity entity) const -> void* {
+        const u32 index = index_of(entity);
+        return index == ABSENT ? nullptr : at(index);
+    }
+    
+    /**
+     * @brief Get an uninitialized slot for an entity's component
+     * 
+     * ⚠️ IMPURE (may grow storage; destroys an existing component of the entity)
+     * 
+     * The caller must construct the component in the returned slot.
+     * 
+     * @param entity Entity handle
+     * @param tick Change tick to stamp
+     * @return Uninitialized slot
+     */
+    auto acquire(Entity entity, u32 tick) -> void*;
+    
+    /**
+     * @brief Insert (or replace) an entity's component, relocating it from caller storage
+     * 
+     * ⚠️ IMPURE (may grow storage; ends the lifetime of *component)
+     * 
+     * @param entity Entity handle
+     * @param component Live component to relocate from
+     * @param tick Change tick to stamp
+     * @return Component in the set
+     */
+    auto insert(Entity entity, void* component, u32 tick) -> void* {
+        void* slot = acquire(entity, tick);
+        info_.relocate_to(slot, component);
+        return slot;
+    }
+    
+    /**
+     * @brief Remove an entity's component (swap-pop)
+     * 
+     * ⚠️ IMPURE (destroys the component)
+     * 
+     * @param entity Entity handle
+     * @return true if the entity had the component
+     */
+    auto erase(Entity entity) -> bool;
+    
+    /**
+     * @brief Destroy all components
+     * 
+     * ⚠️ IMPURE (keeps allocated pages and capacity)
+     */
+    auto clear() -> void;
+    
+    /**
+     * @brief Deep-copy the set (components, ticks and sparse pages)
+     * 
+     * ✨ PURE FUNCTION ✨ (allocates the copy)
+     * 
+     * Trivially copyable components are copied with one memcpy.
+     * 
+     * @return Independent copy
+     * 
+     * @note The component type must be copyable (info().copy_construct != nullptr)
+     */
+    [[nodiscard]] auto clone() const -> std::unique_ptr<SparseSet>;
+    
+    /**
+     * @brief Release unused capacity and sparse pages with no entries
+     * 
+     * ⚠️ IMPURE (reallocates packed storage)
+     */
+    auto shrink() -> void;
+    
+    /**
+     * @brief Get component at a dense index
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto at(u32 index) const -> void* {
+        return data_ + static_cast<std::size_t>(index) * info_.size;
+    }
+    
+    /**
+     * @brief Get change tick of the component at a dense index
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto tick(u32 index) const -> u32 {
+        return ticks_[index];
+    }
+    
+    /**
+     * @brief Stamp the component at a dense index as written
+     * 
+     * ⚠️ IMPURE (updates tick)
+     */
+    auto mark_changed(u32 index, u32 tick) -> void {
+        ticks_[index] = tick;
+    }
+    
+    [[nodiscard]] auto entities() const -> std::span<const Entity> { return entities_; }
+    [[nodiscard]] auto size() const -> std::size_t { return entities_.size(); }
+    [[nodiscard]] auto type_id() const -> u32 { return type_id_; }
+    [[nodiscard]] auto info() const -> const ComponentTypeInfo& { return info_; }
+
+private:
+    /**
+     * @brief Sparse slot for an entity ID (allocates its page)
+     */
+    auto slot(u32 id) -> u32&;
+    
+    /**
+     * @brief Grow packed component storage to hold at least count components
+     */
+    auto reserve(std::size_t count) -> void;
+    
+    u32 type_id_;  ///< Component type ID
+    ComponentTypeInfo info_;  ///< Operations table
+    std::vector<std::unique_ptr<u32[]>> pages_;  ///< Entity ID -> dense index (pages allocated on demand)
+    std::vector<Entity> entities_;  ///< Dense: owner of each component
+    std::vector<u32> ticks_;  ///< Dense: change tick of each component
+    std::byte* data_{nullptr};  ///< Dense: packed components
+    std::size_t capacity_{0};  ///< Components that fit in data_
+};
+
+} // namespace luma::scene
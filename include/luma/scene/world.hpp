@@ -7,8 +7,10 @@
  * 
  * **Architecture**:
  * - **Archetype Storage**: Entities grouped by component signature
- * - **Sparse Sets**: Fast entity → archetype lookup (O(1))
- * - **SoA Layout**: Components stored contiguously for cache efficiency
+ * - **Sparse Sets**: Fast entity → archetype lookup (O(1)); optional sparse-set
+ *   storage for frequently toggled components (StoragePolicy::SPARSE)
+ * - **SoA Layout**: Components stored in 16 KiB chunks for cache efficiency
+ * - **Relationships**: (relation, target) pairs with a reverse index (relation.hpp)
  * - **Immutable Entities**: Entity IDs never change (generation for safety)
  * 
  * ✨ FUNCTIONAL DESIGN ✨
@@ -22,33 +24,43 @@
 
 #pragma once
 
+#include <luma/core/jobs.hpp>
 #include <luma/core/types.hpp>
 #include <luma/scene/component.hpp>
 #include <luma/scene/entity.hpp>
 #include <luma/scene/archetype.hpp>
+#include <luma/scene/registry.hpp>
+#include <luma/scene/relation.hpp>
+#include <luma/scene/snapshot.hpp>
+#include <luma/scene/sparse_set.hpp>
 
+#include <array>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace luma::scene {
 
-// Constants
-constexpr u32 INVALID_ARCHETYPE = static_cast<u32>(-1);
-
 /**
  * @brief Entity metadata (internal bookkeeping)
  * 
  * Tracks which archetype an entity belongs to and its index within that archetype.
+ * 12 bytes in both handle widths (a u32 generation fills the padding a u8 leaves).
  */
 struct EntityMeta {
-    u8 generation{0};  ///< Generation counter (for stale handle detection)
+    EntityGeneration generation{0};  ///< Generation counter (for stale handle detection)
     u32 archetype_index{INVALID_ARCHETYPE};  ///< Index of archetype in archetypes_ vector
     u32 entity_index{0};  ///< Index within archetype's component arrays
 };
 
+static_assert(sizeof(EntityMeta) == 12, "EntityMeta should stay compact (one per entity ID)");
+
 /**
  * @brief ECS World - container for all entities and components
  * 
@@ -110,6 +122,97 @@ public:
      */
     [[nodiscard]] auto create_entity() -> Entity;
     
+    /**
+     * @brief Create entity directly in its final archetype
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * Resolves the archetype for the whole component set once and constructs
+     * every component in place, instead of migrating the entity through one
+     * intermediate archetype per add_component() call.
+     * 
+     * Example:
+     * @code
+     * auto ball = world.spawn(Transform{}, Geometry::sphere(0.5f), Velocity{});
+     * @endcode
+     * 
+     * @tparam Components Component types (each type at most once)
+     * @param components Component data (forwarded into chunk storage)
+     * @return Entity handle
+     */
+    template<typename... Components>
+    auto spawn(Components&&... components) -> Entity;
+    
+    /**
+     * @brief Create many entities with the same component set
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * The destination archetype is resolved once for the whole batch. Each
+     * component is default-constructed in place, then init(i, components...)
+     * is invoked so the caller can fill in entity i's data directly in chunk
+     * storage (one write per component, no copies).
+     * 
+     * Example:
+     * @code
+     * auto particles = world.spawn_batch<Transform, Velocity>(10'000,
+     *     [&](std::size_t i, Transform& t, Velocity& v) {
+     *         t.position = emitter_position;
+     *         v.linear = random_direction(i);
+     *     });
+     * @endcode
+     * 
+     * @tparam Components Component types (default-constructible, each at most once)
+     * @tparam Init Callback type invocable as init(std::size_t, Components&...)
+     * @param count Number of entities to create
+     * @param init Per-entity initializer
+     * @return Entity handles in creation order
+     */
+    template<typename... Components, typename Init>
+    auto spawn_batch(std::size_t count, Init&& init) -> std::vector<Entity>;
+    
+    /**
+     * @brief Create many entities with default-constructed components
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * @tparam Components Component types (default-constructible, each at most once)
+     * @param count Number of entities to create
+     * @return Entity handles in creation order
+     */
+    template<typename... Components>
+    auto spawn_batch(std::size_t count) -> std::vector<Entity> {
+        return spawn_batch<Components...>(count, [](std::size_t, Components&...) {});
+    }
+    
+    /**
+     * @brief Column filler for spawn_columns()
+     * 
+     * Must construct `count` components of type `type_id` in the
+     * uninitialized, contiguous storage at `dst`; they belong to rows
+     * [first, first + count) of the batch.
+     */
+    using ColumnFill = std::function<void(u32 type_id, void* dst, u32 first, u32 count)>;
+    
+    /**
+     * @brief Spawn many entities, constructing components column by column
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * Type-erased bulk counterpart of spawn_batch(): all new entities share
+     * one archetype, rows are appended a chunk-contiguous run at a time and
+     * `fill` is called once per column per run, so a loader can memcpy a
+     * whole column slice (or decode it in a tight loop) instead of adding
+     * components one entity at a time.
+     * 
+     * @param type_ids Table and tag component type IDs (sparse-set types are
+     *                 ignored; add them afterwards with add_component_by_id())
+     * @param count Number of entities
+     * @param fill Column filler (not called for tags)
+     * @return New entities in row order
+     */
+    auto spawn_columns(std::span<const u32> type_ids, u32 count, const ColumnFill& fill) -> std::vector<Entity>;
+    
     /**
      * @brief Destroy entity and remove all its components
      * 
@@ -140,7 +243,7 @@ public:
      * If entity already has this component type, it is replaced.
      * Entity may move to different archetype (signature changes).
      * 
-     * @tparam T Component type (must be one of the defined components)
+     * @tparam T Component type (built-in or any user type, see ComponentRegistry)
      * @param entity Target entity
      * @param component Component data
      */
@@ -197,6 +300,183 @@ public:
     template<typename T>
     [[nodiscard]] auto get_component(Entity entity) -> T*;
     
+    /**
+     * @brief Add component by type ID, relocating it from caller storage
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * Type-erased counterpart of add_component<T>(). On success the source
+     * object is relocated into the world (its storage is dead afterwards);
+     * an existing component of the same type is replaced.
+     * 
+     * @param entity Target entity
+     * @param type_id Component type ID
+     * @param component Live component to relocate from
+     * @return true if consumed (false if entity is dead; source untouched)
+     */
+    auto add_component_by_id(Entity entity, u32 type_id, void* component) -> bool;
+    
+    /**
+     * @brief Remove component by type ID
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * Type-erased body of remove_component<T>(); does nothing if the entity
+     * is dead or lacks the component.
+     * 
+     * @param entity Target entity
+     * @param type_id Component type ID
+     */
+    auto remove_component_by_id(Entity entity, u32 type_id) -> void;
+    
+    /**
+     * @brief Check if entity has component by type ID
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * Type-erased counterpart of has_component<T>() (tags included).
+     * 
+     * @param entity Target entity
+     * @param type_id Component type ID
+     * @return true if entity is alive and has the component
+     */
+    [[nodiscard]] auto has_component_by_id(Entity entity, u32 type_id) const -> bool;
+    
+    /**
+     * @brief Get component by type ID (read-only)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * Type-erased counterpart of get_component<T>(); interpret the bytes
+     * through the type's ComponentTypeInfo / reflected fields.
+     * 
+     * @param entity Target entity
+     * @param type_id Component type ID
+     * @return Pointer to component (nullptr if absent, dead entity, or tag)
+     */
+    [[nodiscard]] auto get_component_by_id(Entity entity, u32 type_id) const -> const void*;
+    
+    /**
+     * @brief Get change tick of one component by type ID
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param entity Target entity
+     * @param type_id Component type ID
+     * @return Tick of the most recent write (0 if absent, dead entity, or tag)
+     */
+    [[nodiscard]] auto component_tick_by_id(Entity entity, u32 type_id) const -> u32;
+    
+    /**
+     * @brief Get all alive entities
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * Includes entities without any component. O(entity IDs ever created).
+     * 
+     * @return Alive entities in ascending ID order
+     */
+    [[nodiscard]] auto entities() const -> std::vector<Entity>;
+    
+    /**
+     * @brief Add relationship pair (R, target) to source
+     * 
+     * ⚠️ IMPURE (modifies relation index; no archetype change)
+     * 
+     * Exclusive relations (R::exclusive_relation) replace the source's
+     * previous target. See relation.hpp.
+     * 
+     * @code
+     * struct ChildOf { static constexpr bool exclusive_relation = true; };
+     * world.add_pair<ChildOf>(wheel, car);
+     * for (Entity part : world.sources<ChildOf>(car)) { ... }  // O(result)
+     * @endcode
+     * 
+     * @tparam R Relation type (label only, never instantiated)
+     * @param source Entity holding the relation
+     * @param target Entity the relation points at
+     * @return false if either entity is dead or the pair already exists
+     */
+    template<typename R>
+    auto add_pair(Entity source, Entity target) -> bool;
+    
+    /**
+     * @brief Remove relationship pair (R, target) from source
+     * 
+     * ⚠️ IMPURE (modifies relation index)
+     * 
+     * @tparam R Relation type
+     * @return true if the pair existed
+     */
+    template<typename R>
+    auto remove_pair(Entity source, Entity target) -> bool;
+    
+    /**
+     * @brief Check for relationship pair (R, target) on source
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @tparam R Relation type
+     */
+    template<typename R>
+    [[nodiscard]] auto has_pair(Entity source, Entity target) const -> bool {
+        const auto* index = relation_index(component_id<R>());
+        return index && index->contains(source, target);
+    }
+    
+    /**
+     * @brief Get targets of relation R on source
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @tparam R Relation type
+     * @return Targets (unordered; invalidated by the next pair change of R)
+     */
+    template<typename R>
+    [[nodiscard]] auto targets(Entity source) const -> std::span<const Entity> {
+        const auto* index = relation_index(component_id<R>());
+        return index ? index->targets(source) : std::span<const Entity>{};
+    }
+    
+    /**
+     * @brief Get single target of relation R on source
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @tparam R Relation type (typically exclusive)
+     * @return First target (NULL_ENTITY if none)
+     */
+    template<typename R>
+    [[nodiscard]] auto target(Entity source) const -> Entity {
+        const auto found = targets<R>(source);
+        return found.empty() ? NULL_ENTITY : found.front();
+    }
+    
+    /**
+     * @brief Get all sources with pair (R, target) (reverse index, O(result))
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @tparam R Relation type
+     * @return Sources (unordered; invalidated by the next pair change of R)
+     */
+    template<typename R>
+    [[nodiscard]] auto sources(Entity target) const -> std::span<const Entity> {
+        const auto* index = relation_index(component_id<R>());
+        return index ? index->sources(target) : std::span<const Entity>{};
+    }
+    
+    /**
+     * @brief Get number of pairs of relation R
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    template<typename R>
+    [[nodiscard]] auto pair_count() const -> std::size_t {
+        const auto* index = relation_index(component_id<R>());
+        return index ? index->pair_count() : 0;
+    }
+    
     /**
      * @brief Query entities with specific components (read-only)
      * 
@@ -234,182 +514,914 @@ public:
     auto each(Func&& func) -> void;
     
     /**
-     * @brief Get total number of entities (alive)
+     * @brief Query matching chunks (read-only)
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * @return Count of alive entities
+     * Invokes the callback once per archetype chunk that has ALL specified
+     * component types. The callback receives the chunk's entity list and one
+     * span per component; element i of every span belongs to entities[i].
+     * Chunks are the natural unit for batching and parallel jobs.
+     * 
+     * Example:
+     * @code
+     * world.each_chunk<Transform, Velocity>([](std::span<const Entity> entities,
+     *                                          std::span<const Transform> transforms,
+     *                                          std::span<const Velocity> velocities) {
+     *     for (std::size_t i = 0; i < entities.size(); ++i) { ... }
+     * });
+     * @endcode
+     * 
+     * @tparam Components Component types to query
+     * @tparam Func Callback function type
+     * @param func Callback invoked for each matching chunk
      */
-    [[nodiscard]] auto entity_count() const -> std::size_t;
+    template<typename... Components, typename Func>
+    auto each_chunk(Func&& func) const -> void;
     
     /**
-     * @brief Clear all entities and components
+     * @brief Query matching chunks (mutable)
      * 
-     * ⚠️ IMPURE (destroys all state)
+     * ⚠️ IMPURE (allows mutation)
      * 
-     * Resets world to empty state (no entities).
+     * Same as const each_chunk() but component spans are mutable. Terms may
+     * be const-qualified to mix read-only and writable columns, which keeps
+     * kernels honest and lets them run over plain contiguous arrays:
+     * 
+     * @code
+     * world.each_chunk<Transform, const Velocity>([dt](std::span<const Entity>,
+     *                                                 std::span<Transform> transforms,
+     *                                                 std::span<const Velocity> velocities) {
+     *     for (std::size_t i = 0; i < transforms.size(); ++i) {  // auto-vectorizable
+     *         transforms[i].position += velocities[i].linear * dt;
+     *     }
+     * });
+     * @endcode
+     * 
+     * @tparam Components Component types to query (optionally const-qualified)
+     * @tparam Func Callback function type
+     * @param func Callback invoked for each matching chunk
      */
-    auto clear() -> void;
-
-private:
+    template<typename... Components, typename Func>
+    auto each_chunk(Func&& func) -> void;
+    
     /**
-     * @brief Get or create archetype for given component signature
+     * @brief Query entities in parallel on the job system (mutable)
      * 
-     * ⚠️ IMPURE (may allocate new archetype)
+     * ⚠️ IMPURE (allows mutation, runs callback on worker threads)
      * 
-     * @param signature Component signature bitset
-     * @return Index of archetype in archetypes_ vector
+     * Matching chunks are split into contiguous batches (a few per worker
+     * thread) and processed as jobs; the calling thread helps while waiting
+     * and the call returns once every entity has been visited.
+     * 
+     * **Write-safety contract** (caller's responsibility):
+     * - The callback runs concurrently for different entities; each matching
+     *   entity is visited exactly once, by exactly one thread
+     * - It may freely mutate the components it is handed (no two threads
+     *   ever receive the same component)
+     * - It must NOT change world structure (create/destroy entities,
+     *   add/remove components) or touch other entities' components; record
+     *   such changes and apply them after par_each returns
+     * - Captured shared state must be read-only or synchronized (atomics,
+     *   per-thread accumulators)
+     * 
+     * Example:
+     * @code
+     * world.par_each<Transform, Velocity>(jobs, [dt](Entity, Transform& t, Velocity& v) {
+     *     t.position += v.linear * dt;
+     * });
+     * @endcode
+     * 
+     * @tparam Components Component types to query
+     * @tparam Func Callback type (invoked as func(Entity, Components&...))
+     * @param jobs Job system to run on
+     * @param func Callback invoked for each matching entity
      */
-    auto get_or_create_archetype(ComponentSignature signature) -> u32;
+    template<typename... Components, typename Func>
+    auto par_each(JobSystem& jobs, Func&& func) -> void;
     
     /**
-     * @brief Move entity to different archetype
+     * @brief Query entities in parallel on the job system (read-only)
      * 
-     * ⚠️ IMPURE (modifies archetypes and metadata)
+     * ✨ PURE FUNCTION ✨ (with respect to the world)
      * 
-     * @param entity Entity to move
-     * @param new_archetype_index Target archetype index
+     * Same scheduling as the mutable par_each(); components are passed as
+     * const references, so only captured state needs synchronization.
+     * 
+     * @tparam Components Component types to query
+     * @tparam Func Callback type (invoked as func(Entity, const Components&...))
+     * @param jobs Job system to run on
+     * @param func Callback invoked for each matching entity
      */
-    auto move_entity_to_archetype(Entity entity, u32 new_archetype_index) -> void;
+    template<typename... Components, typename Func>
+    auto par_each(JobSystem& jobs, Func&& func) const -> void;
     
     /**
-     * @brief Copy components from old archetype to new archetype
+     * @brief Query matching chunks in parallel on the job system (mutable)
      * 
-     * Helper for archetype migration - copies all component data that exists
-     * in both old and new archetypes.
+     * ⚠️ IMPURE (allows mutation, runs callback on worker threads)
      * 
-     * ⚠️ IMPURE (modifies new archetype's component arrays)
+     * Chunk-level variant of par_each() with the same write-safety contract;
+     * the callback receives the same spans as each_chunk().
      * 
-     * @param entity Entity being moved
-     * @param old_archetype Source archetype
-     * @param old_index Entity index in old archetype
-     * @param new_archetype Destination archetype
+     * @tparam Components Component types to query
+     * @tparam Func Callback type
+     * @param jobs Job system to run on
+     * @param func Callback invoked for each matching chunk
      */
-    auto copy_components_to_archetype(
-        Entity entity,
-        Archetype* old_archetype,
-        u32 old_index,
-        Archetype* new_archetype
-    ) -> void;
+    template<typename... Components, typename Func>
+    auto par_each_chunk(JobSystem& jobs, Func&& func) -> void;
     
     /**
-     * @brief Compute component signature for set of types
+     * @brief Query matching chunks in parallel on the job system (read-only)
      * 
-     * ✨ PURE FUNCTION ✨
+     * ✨ PURE FUNCTION ✨ (with respect to the world)
      * 
-     * @tparam Components Component types
-     * @return Bitset signature
+     * @tparam Components Component types to query
+     * @tparam Func Callback type
+     * @param jobs Job system to run on
+     * @param func Callback invoked for each matching chunk
      */
-    template<typename... Components>
-    [[nodiscard]] static constexpr auto compute_signature() -> ComponentSignature {
-        ComponentSignature sig = 0;
-        ((sig |= (ComponentSignature(1) << component_id<Components>())), ...);
-        return sig;
-    }
+    template<typename... Components, typename Func>
+    auto par_each_chunk(JobSystem& jobs, Func&& func) const -> void;
     
     /**
-     * @brief Get component type ID (unique per type)
+     * @brief Iterate components of one type written after a tick (read-only)
      * 
      * ✨ PURE FUNCTION ✨
      * 
-     * Uses template specialization to assign unique IDs.
+     * Visits every T whose change tick is greater than since_tick. A write is
+     * any mutable access: add_component/spawn, mutable get_component, or a
+     * mutable each/each_chunk/par_each/Query over T (those mark the whole
+     * chunk column, so results are conservative: never a missed change, but
+     * possibly rows that were handed out and left untouched). Chunks whose
+     * column has not changed are skipped without touching their rows.
+     * 
+     * Typical frame:
+     * @code
+     * const u32 last_upload = world.change_tick();
+     * world.advance_tick();
+     * run_systems(world);
+     * world.each_changed<Transform>(last_upload, [&](Entity e, const Transform& t) {
+     *     upload(e, t);
+     * });
+     * @endcode
      * 
      * @tparam T Component type
-     * @return Component type ID (0-63)
+     * @tparam Func Callback type (invoked as func(Entity, const T&))
+     * @param since_tick Report writes with tick > since_tick
+     * @param func Callback invoked for each changed component
+     */
+    template<typename T, typename Func>
+    auto each_changed(u32 since_tick, Func&& func) const -> void;
+    
+    /**
+     * @brief Allow mutable get_component<T>() from several threads this tick
+     * 
+     * ⚠️ IMPURE (raises per-chunk change hints of T)
+     * 
+     * Mutable access stamps the row's tick and the chunk column's
+     * latest-write hint; the hint is shared by the rows of a chunk. This
+     * raises the hint of every T column to the current tick up front
+     * (O(chunks)), after which mutable get_component<T>() on distinct
+     * entities only writes per-row state and may run concurrently, until the
+     * next structural change or advance_tick(). Row ticks are untouched, so
+     * each_changed<T>() stays exact (it just visits the rows of every chunk).
+     * 
+     * @tparam T Table component type
      */
     template<typename T>
-    [[nodiscard]] static constexpr auto component_id() -> u32 {
-        // Use simple if-else chain for type IDs
-        if constexpr (std::is_same_v<T, Transform>) return 0;
-        else if constexpr (std::is_same_v<T, Geometry>) return 1;
-        else if constexpr (std::is_same_v<T, Material>) return 2;
-        else if constexpr (std::is_same_v<T, Velocity>) return 3;
-        else if constexpr (std::is_same_v<T, Name>) return 4;
-        else static_assert(false, "Unknown component type");
+    auto prepare_concurrent_writes() -> void {
+        static_assert(!is_sparse_component_v<T> && !is_tag_component_v<T>,
+                      "Concurrent writes are prepared for table components only");
+        const u32 type_id = component_id<T>();
+        for (auto& archetype : archetypes_) {
+            if (!archetype->signature().test(type_id)) {
+                continue;
+            }
+            for (std::size_t k = 0; k < archetype->chunk_count(); ++k) {
+                archetype->chunk(k).raise_changed_tick(type_id, change_tick_);
+            }
+        }
     }
     
-    std::vector<EntityMeta> entity_meta_;  ///< Entity metadata (indexed by entity ID)
-    std::vector<u32> free_entities_;  ///< Free list for recycled entity IDs
-    std::size_t entity_count_{0};  ///< Number of alive entities
+    /**
+     * @brief Get current change tick
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * Writes are stamped with this tick. Starts at 1, so since_tick = 0
+     * reports every component ever written.
+     * 
+     * @return Current tick
+     */
+    [[nodiscard]] auto change_tick() const -> u32 {
+        return change_tick_;
+    }
     
-    std::vector<std::unique_ptr<Archetype>> archetypes_;  ///< Archetype storage
-    std::unordered_map<ComponentSignature, u32> archetype_map_;  ///< Signature -> archetype index
-};
-
-// ========== Template Method Implementations ==========
-
-template<typename T>
-auto World::add_component(Entity entity, T component) -> void {
-    if (!is_alive(entity)) {
-        return;
+    /**
+     * @brief Start a new change tick (typically once per frame)
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * @return New current tick
+     */
+    auto advance_tick() -> u32 {
+        return ++change_tick_;
     }
     
-    const auto id = entity.id();
-    auto& meta = entity_meta_[id - 1];  // Convert ID to index (IDs start at 1)
+    /**
+     * @brief Get total number of entities (alive)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Count of alive entities
+     */
+    [[nodiscard]] auto entity_count() const -> std::size_t;
     
-    // Compute new signature with added component
-    ComponentSignature old_sig = 0;
-    if (meta.archetype_index != INVALID_ARCHETYPE) {
-        old_sig = archetypes_[meta.archetype_index]->signature();
+    /**
+     * @brief Get number of archetypes (distinct component signatures seen)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @return Archetype count
+     */
+    [[nodiscard]] auto archetype_count() const -> std::size_t {
+        return archetypes_.size();
     }
-    const ComponentSignature new_sig = old_sig | (ComponentSignature(1) << component_id<T>());
     
-    // Get or create archetype for new signature
-    const auto new_archetype_idx = get_or_create_archetype(new_sig);
-    
-    // Ensure archetype has component array for T
-    auto& new_archetype = archetypes_[new_archetype_idx];
-    if (!new_archetype->has_component_array(component_id<T>())) {
-        new_archetype->add_component_array<T>(component_id<T>());
+    /**
+     * @brief Get archetype by index (read-only)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param index Archetype index (< archetype_count())
+     * @return Archetype reference
+     */
+    [[nodiscard]] auto archetype(std::size_t index) const -> const Archetype& {
+        return *archetypes_[index];
     }
     
-    // Move entity to new archetype (if needed) - this will copy existing components
-    if (meta.archetype_index != new_archetype_idx) {
-        move_entity_to_archetype(entity, new_archetype_idx);
+    /**
+     * @brief Get archetype by index (mutable)
+     * 
+     * ⚠️ IMPURE (allows mutation)
+     * 
+     * @param index Archetype index (< archetype_count())
+     * @return Archetype reference
+     */
+    [[nodiscard]] auto archetype(std::size_t index) -> Archetype& {
+        return *archetypes_[index];
     }
     
-    // Add component data
-    new_archetype->add_component<T>(component_id<T>(), std::move(component));
-}
+    /**
+     * @brief Get archetype epoch
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * Archetypes are append-only between epochs: indices stay valid and new
+     * archetypes are only added at the end. The epoch changes whenever that
+     * no longer holds (e.g. clear()), telling cached queries to rebuild.
+     * 
+     * @return Current epoch
+     */
+    [[nodiscard]] auto archetype_epoch() const -> u64 {
+        return archetype_epoch_;
+    }
+    
+    /**
+     * @brief Clear all entities and components
+     * 
+     * ⚠️ IMPURE (destroys all state)
+     * 
+     * Resets world to empty state (no entities).
+     */
+    auto clear() -> void;
+    
+    /**
+     * @brief Capture the world state (see snapshot.hpp)
+     * 
+     * ⚠️ IMPURE (starts a new change tick)
+     * 
+     * Chunks not written since the previous snapshot of this world are
+     * shared with it instead of copied. The tick is advanced afterwards so
+     * any later write is distinguishable from the captured state.
+     * 
+     * @return Snapshot, or SCENE_COMPONENT_NOT_COPYABLE if a live component
+     *         type is move-only
+     */
+    [[nodiscard]] auto snapshot() -> Result<WorldSnapshot>;
+    
+    /**
+     * @brief Row ordering key for compaction (rows sorted by ascending key)
+     * 
+     * Called once per row with the row's entity; may read the world (e.g.
+     * a Morton code of the entity's position) but must not modify it.
+     */
+    using RowKey = std::function<u64(Entity)>;
+    
+    /**
+     * @brief Run one time slice of the memory compaction pass
+     * 
+     * ⚠️ IMPURE (frees storage, may move rows and renumber archetypes)
+     * 
+     * The pass is a sequence of small steps resumed across calls:
+     * 1. drop empty archetypes: the last archetype takes over an empty
+     *    slot and its rows move there one chunk per step (bumps
+     *    archetype_epoch() when a slot changes hands)
+     * 2. per archetype: release the spare chunk and table slack, and
+     *    reorder rows by key when one is given (skipped if already sorted):
+     *    keys are taken one chunk per step, then rows are swapped into
+     *    place one destination chunk per step
+     * 3. per sparse set: repack storage, free unused pages
+     * 4. shrink entity bookkeeping: free IDs at the top of the ID range are
+     *    released, the rest are reused lowest first so the ID space (and
+     *    sparse-set pages) stays dense
+     * 
+     * The world is consistent between steps, so frames may run between
+     * calls; a reorder interrupted by structural changes to its archetype
+     * is dropped for this pass. At least one step runs per call; a call
+     * overshoots its budget by at most one step (about one chunk of rows).
+     * Run it between frames, never while iterating or while a
+     * CommandBuffer holds recorded operations.
+     * 
+     * @code
+     * // between frames
+     * world.compact(std::chrono::microseconds{500});
+     * @endcode
+     * 
+     * @param budget Time allowed for this slice
+     * @param key Optional row order applied in step 2
+     * @return true if this call finished a full pass
+     */
+    auto compact(std::chrono::microseconds budget, const RowKey& key = {}) -> bool;
+    
+    /**
+     * @brief Sort one archetype's rows by ascending key
+     * 
+     * ⚠️ IMPURE (relocates rows, updates entity locations)
+     * 
+     * Stable. An archetype already in order is left untouched. Rows keep
+     * their change ticks, so a sort does not read as a write. Entity handles
+     * stay valid; row indices and component pointers into the archetype do not.
+     * 
+     * @param archetype_index Archetype index (< archetype_count())
+     * @param key Row order
+     * @return true if rows moved
+     */
+    auto sort_rows(u32 archetype_index, const RowKey& key) -> bool;
+    
+    /**
+     * @brief Replace the world state with a snapshot (of this or another world)
+     * 
+     * ⚠️ IMPURE (destroys all current state, invalidates cached queries)
+     * 
+     * Entity handles, archetype layout, sparse sets and relationship pairs
+     * come back exactly as captured. Every restored component counts as
+     * written at a new tick, so change queries see the rollback.
+     * 
+     * @param snapshot Snapshot to restore (empty = clear())
+     */
+    auto restore(const WorldSnapshot& snapshot) -> void;
+
+private:
+    friend class CommandBuffer;  // Applies recorded type-erased operations
+    template<typename...> friend class Query;  // Iterates sparse-set terms through visit_matching()
+    
+    /**
+     * @brief Get or create archetype holding exactly the given type IDs
+     * 
+     * ⚠️ IMPURE (may allocate new archetype)
+     * 
+     * @param type_ids Component type IDs (a repeated ID counts once)
+     * @return Index of archetype in archetypes_ vector (INVALID_ARCHETYPE if all types are sparse)
+     */
+    auto archetype_for_ids(std::span<const u32> type_ids) -> u32;
+    
+    /**
+     * @brief Create entity in an archetype, relocating its components from caller storage
+     * 
+     * ⚠️ IMPURE (modifies world state)
+     * 
+     * @param archetype_index Destination (from archetype_for_ids(type_ids))
+     * @param type_ids Component type IDs (one per archetype column)
+     * @param components Live components to relocate from (same order as type_ids)
+     * @return New entity
+     */
+    auto spawn_by_ids(u32 archetype_index, std::span<const u32> type_ids,
+                      std::span<void* const> components) -> Entity;
+    
+    /**
+     * @brief Get archetype index of a live entity (for batching)
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param entity Entity
+     * @return Archetype index (INVALID_ARCHETYPE if dead or component-less)
+     */
+    [[nodiscard]] auto archetype_of(Entity entity) const -> u32 {
+        return is_alive(entity) ? entity_meta_[entity.id() - 1].archetype_index : INVALID_ARCHETYPE;
+    }
+    
+    /**
+     * @brief Get or create archetype for given component signature
+     * 
+     * ⚠️ IMPURE (may allocate new archetype)
+     * 
+     * @param signature Component signature bitset
+     * @param columns Column descriptions (used only if the archetype is new)
+     * @return Index of archetype in archetypes_ vector
+     */
+    auto get_or_create_archetype(
+        const ComponentSignature& signature,
+        std::vector<ArchetypeColumn> columns
+    ) -> u32;
+    
+    /**
+     * @brief Get or create archetype holding exactly the given table components
+     * 
+     * ⚠️ IMPURE (may allocate new archetype)
+     * 
+     * Sparse-set components are skipped (they live outside archetypes).
+     * 
+     * @tparam Components Component types
+     * @return Index of archetype in archetypes_ vector (INVALID_ARCHETYPE if all are sparse)
+     */
+    template<typename... Components>
+    auto archetype_for() -> u32;
+    
+    /**
+     * @brief Construct a component of a freshly spawned entity in its storage
+     * 
+     * ⚠️ IMPURE (placement-new into chunk row or sparse set)
+     * 
+     * @tparam T Component type
+     * @param entity Entity
+     * @param archetype_index Entity's archetype (table components only)
+     * @param row Entity's row in the archetype
+     * @param args Constructor arguments
+     * @return Constructed component
+     */
+    template<typename T, typename... Args>
+    auto emplace_component(Entity entity, u32 archetype_index, u32 row, Args&&... args) -> T* {
+        if constexpr (is_tag_component_v<T>) {
+            static T tag{};  // Tags have no per-entity storage; callbacks get a shared instance
+            return &tag;
+        }
+        
+        void* slot = nullptr;
+        if constexpr (is_sparse_component_v<T>) {
+            slot = sparse_set_for(component_id<T>(), ComponentTypeInfo::of<T>()).acquire(entity, change_tick_);
+        } else {
+            slot = archetypes_[archetype_index]->component_raw(component_id<T>(), row);
+        }
+        return ::new (slot) T(std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Get sparse set of a component type
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param type_id Component type ID
+     * @return Set (nullptr if no entity ever had the component or it is a table type)
+     */
+    [[nodiscard]] auto sparse_set(u32 type_id) const -> SparseSet* {
+        return type_id < sparse_sets_.size() ? sparse_sets_[type_id].get() : nullptr;
+    }
+    
+    /**
+     * @brief Get or create sparse set of a component type
+     * 
+     * ⚠️ IMPURE (may allocate set)
+     * 
+     * @param type_id Component type ID
+     * @param info Operations table (used only if the set is new)
+     * @return Set
+     */
+    auto sparse_set_for(u32 type_id, const ComponentTypeInfo& info) -> SparseSet&;
+    
+    /**
+     * @brief Get pair index of a relation type (nullptr if it has no pairs yet)
+     * 
+     * ✨ PURE FUNCTION ✨
+     */
+    [[nodiscard]] auto relation_index(u32 type_id) const -> RelationIndex* {
+        return type_id < relations_.size() ? relations_[type_id].get() : nullptr;
+    }
+    
+    /**
+     * @brief Get pair index of a relation type, creating it on first use
+     * 
+     * ⚠️ IMPURE (may allocate the index)
+     * 
+     * @param type_id Relation type ID
+     * @param exclusive At most one target per source
+     */
+    auto relation_index_for(u32 type_id, bool exclusive) -> RelationIndex&;
+    
+    /**
+     * @brief Compaction pass steps (see compact())
+     */
+    enum class CompactionPhase : u8 {
+        ARCHETYPES,  ///< Drop empty archetypes (one slot or one chunk of rows per step)
+        ROWS,  ///< Shrink / reorder archetypes (one chunk per step)
+        SPARSE_SETS,  ///< Shrink one sparse set per step
+        ENTITIES,  ///< Shrink entity bookkeeping (last step)
+    };
+    
+    /**
+     * @brief Progress of the compaction pass, kept between compact() calls
+     */
+    struct CompactionState {
+        CompactionPhase phase{CompactionPhase::ARCHETYPES};  ///< Current step kind
+        u32 cursor{0};  ///< Archetype / sparse set being processed
+        u32 chunk{0};  ///< ROWS: next key chunk, then next destination chunk (after the key chunks)
+        u32 rows{0};  ///< ROWS: archetype size when its keys were taken
+        bool in_order{true};  ///< ROWS: keys taken so far were already ascending
+        u32 move_from{INVALID_ARCHETYPE};  ///< ARCHETYPES: archetype being drained (INVALID = none)
+        u32 move_to{INVALID_ARCHETYPE};  ///< ARCHETYPES: archetype receiving its rows
+        std::vector<std::pair<u64, Entity>> keys;  ///< ROWS: (key, entity), one sorted run per chunk
+        std::vector<std::pair<u64, u32>> heap;  ///< ROWS: merge heap of (run head key, run)
+        std::vector<u32> run_next;  ///< ROWS: next unplaced element of each run
+    };
+    
+    /**
+     * @brief Run one compaction step
+     * 
+     * ⚠️ IMPURE (see compact())
+     * 
+     * @param key Optional row order
+     * @return true if the step finished the pass
+     */
+    auto compact_step(const RowKey& key) -> bool;
+    
+    /**
+     * @brief Run one step of compaction phase 1 (drop empty archetypes)
+     * 
+     * ⚠️ IMPURE (moves rows, may renumber one archetype and bump archetype_epoch_)
+     * 
+     * Either moves up to one chunk of rows out of an archetype being
+     * drained, pops a trailing empty archetype, or hands an empty slot to
+     * the last archetype (which is then drained into it). During a drain
+     * both archetypes share a signature; only the receiving one is in
+     * archetype_map_.
+     * 
+     * @return true once no empty or duplicate archetype is left
+     */
+    auto compact_archetypes_step() -> bool;
+    
+    /**
+     * @brief Run one step of compaction phase 2 on archetype compact_.cursor
+     * 
+     * ⚠️ IMPURE (frees storage, swaps rows)
+     * 
+     * @param key Optional row order
+     * @return true once the archetype is done (or its reorder was dropped)
+     */
+    auto compact_rows_step(const RowKey& key) -> bool;
+    
+    /**
+     * @brief Give archetype slot `to` the edges and map entry of archetype `from`
+     * 
+     * ⚠️ IMPURE (rewrites graph edges, bumps archetype_epoch_)
+     * 
+     * Edges into `to` are dropped, edges into `from` now lead to `to`.
+     * 
+     * @param from Archetype whose edges move (INVALID_ARCHETYPE = only drop `to`)
+     * @param to Archetype slot losing its edges
+     */
+    auto redirect_archetype(u32 from, u32 to) -> void;
+    
+    /**
+     * @brief Visit entities matching table and sparse-set requirements
+     * 
+     * ✨ PURE FUNCTION ✨ (calls visit; does not modify the world itself)
+     * 
+     * Drives iteration from the smallest required sparse set when there is
+     * one (O(set size), e.g. "entities hit this frame"), otherwise walks the
+     * rows of archetypes matching the table requirements.
+     * 
+     * @param required Required table components
+     * @param excluded Excluded table components
+     * @param sparse_required Required sparse-set component type IDs
+     * @param sparse_excluded Excluded sparse-set component type IDs
+     * @param visit Called as visit(entity, archetype_index, row)
+     */
+    template<typename Visit>
+    auto visit_matching(
+        const ComponentSignature& required,
+        const ComponentSignature& excluded,
+        std::span<const u32> sparse_required,
+        std::span<const u32> sparse_excluded,
+        Visit&& visit
+    ) const -> void;
+    
+    /**
+     * @brief Get one component of a located entity from table or sparse storage
+     * 
+     * ⚠️ IMPURE (stamps the change tick for non-const Component)
+     * 
+     * @tparam Component Component type (const-qualified = read-only)
+     * @param type_id Component type ID
+     * @param entity Entity
+     * @param archetype_index Entity's archetype
+     * @param row Entity's row in the archetype
+     * @return Component (nullptr if absent)
+     */
+    template<typename Component>
+    [[nodiscard]] auto fetch(u32 type_id, Entity entity, u32 archetype_index, u32 row) const -> Component*;
+    
+    /**
+     * @brief Split component types into table signature and sparse-set type IDs
+     * 
+     * ⚠️ IMPURE (may register component types)
+     */
+    template<typename... Components>
+    static auto split_storage(ComponentSignature& table, std::vector<u32>& sparse) -> void {
+        ((is_sparse_component_v<Components> ? sparse.push_back(component_id<Components>())
+                                            : void(table.set(component_id<Components>()))), ...);
+    }
+    
+    /**
+     * @brief each() for queries containing sparse-set components
+     * 
+     * @tparam Components Query terms (const-qualified = read-only)
+     */
+    template<typename... Components, typename Func>
+    auto each_with_sparse(Func&& func) const -> void;
+    
+    /**
+     * @brief par_each() for queries containing sparse-set components
+     * 
+     * Matches are collected (and writes stamped) on the calling thread, then
+     * processed in parallel batches.
+     * 
+     * @tparam Components Query terms (const-qualified = read-only)
+     */
+    template<typename... Components, typename Func>
+    auto par_each_with_sparse(JobSystem& jobs, Func&& func) const -> void;
+    
+    /**
+     * @brief Place an entity into a fresh (uninitialized) row of an archetype
+     * 
+     * ⚠️ IMPURE (modifies archetype and metadata)
+     * 
+     * @param entity Entity with no archetype yet
+     * @param archetype_index Destination archetype
+     * @return Row index in the archetype (components still to be constructed)
+     */
+    auto place_entity(Entity entity, u32 archetype_index) -> u32;
+    
+    /**
+     * @brief Typed column span of a chunk, honoring constness of the query term
+     * 
+     * ⚠️ IMPURE (stamps the column's change tick for writable terms)
+     * 
+     * @tparam Component Query term (T -> std::span<T>, const T -> std::span<const T>)
+     * @param chunk Chunk to view
+     * @param type_id Component type ID
+     * @return Column span
+     */
+    template<typename Component>
+    [[nodiscard]] auto column_span(Chunk& chunk, u32 type_id) const -> std::span<Component> {
+        if constexpr (!std::is_const_v<Component>) {
+            chunk.mark_column_changed(type_id, change_tick_);  // Writable span counts as a write
+        }
+        return chunk.column<std::remove_const_t<Component>>(type_id);
+    }
+    
+    /**
+     * @brief Collect chunks of all archetypes containing a signature
+     * 
+     * ✨ PURE FUNCTION ✨
+     * 
+     * @param required Required component signature
+     * @return Non-empty matching chunks
+     */
+    [[nodiscard]] auto matching_chunks(const ComponentSignature& required) const -> std::vector<Chunk*>;
+    
+    /**
+     * @brief Run [0, count) in batches on the job system and wait
+     * 
+     * ⚠️ IMPURE (runs work on worker threads)
+     * 
+     * Splits the range into a few contiguous batches per worker (bounded job
+     * count, so the job queues never overflow).
+     * 
+     * @param jobs Job system
+     * @param count Number of work items
+     * @param work Invoked once per item index
+     */
+    static auto run_parallel(JobSystem& jobs, std::size_t count,
+                             const std::function<void(std::size_t)>& work) -> void;
+    
+    /**
+     * @brief Resolve archetype = source archetype + one component
+     * 
+     * ⚠️ IMPURE (may allocate new archetype, caches graph edges)
+     * 
+     * Follows the source archetype's cached add edge when present; only the
+     * first transition per (archetype, component) pair touches archetype_map_.
+     * 
+     * @param archetype_index Source archetype (INVALID_ARCHETYPE = no components)
+     * @param type_id Component type ID being added (layout comes from ComponentRegistry)
+     * @return Index of destination archetype
+     */
+    auto archetype_with_component(u32 archetype_index, u32 type_id) -> u32;
+    
+    /**
+     * @brief Resolve archetype = source archetype - one component
+     * 
+     * ⚠️ IMPURE (may allocate new archetype, caches graph edges)
+     * 
+     * Follows the source archetype's cached remove edge when present.
+     * 
+     * @param archetype_index Source archetype (must be valid)
+     * @param type_id Component type ID being removed
+     * @return Index of destination archetype
+     */
+    auto archetype_without_component(u32 archetype_index, u32 type_id) -> u32;
+    
+    /**
+     * @brief Move entity to different archetype
+     * 
+     * ⚠️ IMPURE (modifies archetypes and metadata)
+     * 
+     * Components present in both archetypes are relocated (memcpy for
+     * trivially relocatable types, move + destroy otherwise). Columns that
+     * only exist in the destination are left uninitialized for the caller
+     * to construct.
+     * 
+     * @param entity Entity to move
+     * @param new_archetype_index Target archetype index
+     */
+    auto move_entity_to_archetype(Entity entity, u32 new_archetype_index) -> void;
+    
+    /**
+     * @brief Move components from old archetype to new archetype
+     * 
+     * Helper for archetype migration - relocates all component data that
+     * exists in both archetypes (one memcpy for trivially relocatable types,
+     * move + destroy otherwise) and destroys components the new archetype
+     * lacks. Afterwards the old row holds no live components.
+     * 
+     * ⚠️ IMPURE (constructs in the new chunk, ends lifetimes in the old one)
+     * 
+     * @param old_archetype Source archetype
+     * @param old_index Entity index in old archetype
+     * @param new_archetype Destination archetype
+     * @param new_index Entity index in new archetype
+     */
+    auto move_components_to_archetype(
+        Archetype& old_archetype,
+        u32 old_index,
+        Archetype& new_archetype,
+        u32 new_index
+    ) -> void;
+    
+    std::vector<EntityMeta> entity_meta_;  ///< Entity metadata (indexed by entity ID)
+    std::vector<u32> free_entities_;  ///< Free list for recycled entity IDs
+    std::size_t entity_count_{0};  ///< Number of alive entities
+    
+    std::vector<std::unique_ptr<Archetype>> archetypes_;  ///< Archetype storage
+    std::unordered_map<ComponentSignature, u32> archetype_map_;  ///< Signature -> archetype index
+    std::vector<u32> root_add_edges_;  ///< Type ID -> single-component archetype (edges from "no archetype")
+    u64 archetype_epoch_{0};  ///< Bumped when archetype indices are invalidated
+    std::vector<std::unique_ptr<SparseSet>> sparse_sets_;  ///< Type ID -> sparse-set storage (sparse types only)
+    std::vector<std::unique_ptr<RelationIndex>> relations_;  ///< Type ID -> pair index (relation types only)
+    u32 change_tick_{1};  ///< Tick stamped on component writes
+    std::weak_ptr<const WorldSnapshot::Data> last_snapshot_;  ///< Previous snapshot (pages to share)
+    CompactionState compact_;  ///< Resumable compaction pass (see compact())
+    EntityGeneration released_generation_{0};  ///< Generation for new IDs (above those of released IDs)
+};
+
+// ========== Template Method Implementations ==========
 
 template<typename T>
-auto World::remove_component(Entity entity) -> void {
-    if (!is_alive(entity) || !has_component<T>(entity)) {
+auto World::add_component(Entity entity, T component) -> void {
+    if (!is_alive(entity)) {
         return;
     }
     
-    const auto id = entity.id();
-    auto& meta = entity_meta_[id - 1];  // Convert ID to index (IDs start at 1)
+    // Sparse-set components attach without touching the archetype
+    if constexpr (is_sparse_component_v<T>) {
+        auto& set = sparse_set_for(component_id<T>(), ComponentTypeInfo::of<T>());
+        ::new (set.acquire(entity, change_tick_)) T(std::move(component));
+    } else if constexpr (is_tag_component_v<T>) {
+        // Tags: migrate for the signature bit, nothing to construct
+        const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+        if (!has_component<T>(entity)) {
+            move_entity_to_archetype(entity, archetype_with_component(meta.archetype_index, component_id<T>()));
+        }
+    } else {
+        // Replace in place if entity already has this component (no migration)
+        if (auto* existing = get_component<T>(entity)) {
+            *existing = std::move(component);
+            return;
+        }
+        
+        const auto id = entity.id();
+        auto& meta = entity_meta_[id - 1];  // Convert ID to index (IDs start at 1)
+        
+        // Resolve destination archetype (source + T)
+        const u32 new_archetype_idx = archetype_with_component(meta.archetype_index, component_id<T>());
+        
+        // Migrate to the new archetype: existing components are relocated, not copied
+        move_entity_to_archetype(entity, new_archetype_idx);
+        
+        // Construct the new component in its (uninitialized) slot
+        auto& archetype = *archetypes_[new_archetype_idx];
+        archetype.construct_component<T>(component_id<T>(), meta.entity_index, std::move(component));
+        archetype.mark_changed(component_id<T>(), meta.entity_index, change_tick_);
+    }
+}
+
+template<typename... Components>
+auto World::spawn(Components&&... components) -> Entity {
+    static_assert(sizeof...(Components) > 0, "spawn() needs at least one component");
+    static_assert(are_distinct_components_v<Components...>, "spawn() takes each component type at most once");
     
-    // If entity has no archetype, nothing to remove
-    if (meta.archetype_index == INVALID_ARCHETYPE) {
-        return;
+    const u32 archetype_idx = archetype_for<std::remove_cvref_t<Components>...>();
+    const Entity entity = create_entity();
+    const u32 index = archetype_idx != INVALID_ARCHETYPE ? place_entity(entity, archetype_idx) : 0;
+    
+    // Construct each component directly in its chunk slot (or sparse set)
+    (emplace_component<std::remove_cvref_t<Components>>(entity, archetype_idx, index,
+                                                        std::forward<Components>(components)), ...);
+    if (archetype_idx != INVALID_ARCHETYPE) {
+        archetypes_[archetype_idx]->mark_row_changed(index, change_tick_);
     }
     
-    auto& old_archetype = archetypes_[meta.archetype_index];
+    return entity;
+}
+
+template<typename... Components, typename Init>
+auto World::spawn_batch(std::size_t count, Init&& init) -> std::vector<Entity> {
+    static_assert(sizeof...(Components) > 0, "spawn_batch() needs at least one component");
+    static_assert(are_distinct_components_v<Components...>, "spawn_batch() takes each component type at most once");
+    static_assert((std::is_default_constructible_v<Components> && ...),
+                  "spawn_batch() components must be default-constructible");
+    
+    std::vector<Entity> entities;
+    entities.reserve(count);
+    entity_meta_.reserve(entity_meta_.size() + count);
     
-    // Compute new signature without component
-    const ComponentSignature old_sig = old_archetype->signature();
-    const ComponentSignature new_sig = old_sig & ~(ComponentSignature(1) << component_id<T>());
+    // Resolve destination once for the whole batch
+    const u32 archetype_idx = archetype_for<Components...>();
     
-    // If new signature is empty, just remove from current archetype
-    if (new_sig == 0) {
-        // Remove entity from current archetype
-        const auto swapped_entity = old_archetype->remove_entity(meta.entity_index);
-        if (swapped_entity != NULL_ENTITY) {
-            auto& swapped_meta = entity_meta_[swapped_entity.id() - 1];
-            swapped_meta.entity_index = meta.entity_index;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Entity entity = create_entity();
+        const u32 index = archetype_idx != INVALID_ARCHETYPE ? place_entity(entity, archetype_idx) : 0;
+        
+        // Default-construct in place, then let the caller fill the slots
+        init(i, *emplace_component<Components>(entity, archetype_idx, index)...);
+        if (archetype_idx != INVALID_ARCHETYPE) {
+            archetypes_[archetype_idx]->mark_row_changed(index, change_tick_);
         }
-        meta.archetype_index = INVALID_ARCHETYPE;
-        meta.entity_index = 0;
-        return;
+        entities.push_back(entity);
     }
     
-    // Get or create archetype for new signature
-    const auto new_archetype_idx = get_or_create_archetype(new_sig);
+    return entities;
+}
+
+template<typename... Components>
+auto World::archetype_for() -> u32 {
+    ComponentSignature signature;
+    std::vector<u32> sparse;
+    split_storage<Components...>(signature, sparse);
+    if (signature.empty()) {
+        return INVALID_ARCHETYPE;  // Only sparse-set components
+    }
+    if (auto it = archetype_map_.find(signature); it != archetype_map_.end()) {
+        return it->second;
+    }
     
-    // Move entity to new archetype
-    move_entity_to_archetype(entity, new_archetype_idx);
+    std::vector<ArchetypeColumn> columns;
+    ((is_sparse_component_v<Components> || is_tag_component_v<Components>
+          ? void()
+          : columns.push_back(ArchetypeColumn{.type_id = component_id<Components>(),
+                                              .info = ComponentTypeInfo::of<Components>()})), ...);
+    return get_or_create_archetype(signature, std::move(columns));
+}
+
+template<typename R>
+auto World::add_pair(Entity source, Entity target) -> bool {
+    if (!is_alive(source) || !is_alive(target)) {
+        return false;
+    }
+    return relation_index_for(component_id<R>(), is_exclusive_relation_v<R>).add(source, target);
+}
+
+template<typename R>
+auto World::remove_pair(Entity source, Entity target) -> bool {
+    auto* index = relation_index(component_id<R>());
+    return index && index->remove(source, target);
+}
+
+template<typename T>
+auto World::remove_component(Entity entity) -> void {
+    remove_component_by_id(entity, component_id<T>());
 }
 
 template<typename T>
@@ -418,18 +1430,29 @@ auto World::has_component(Entity entity) const -> bool {
         return false;
     }
     
+    if constexpr (is_sparse_component_v<T>) {
+        const auto* set = sparse_set(component_id<T>());
+        return set && set->contains(entity);
+    }
+    
     const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
     if (meta.archetype_index == INVALID_ARCHETYPE) {
         return false;
     }
     
-    const auto& archetype = archetypes_[meta.archetype_index];
-    const ComponentSignature sig = archetype->signature();
-    return (sig & (ComponentSignature(1) << component_id<T>())) != 0;
+    // O(1) bit test (tags have a bit but no column)
+    return archetypes_[meta.archetype_index]->signature().test(component_id<T>());
 }
 
 template<typename T>
 auto World::get_component(Entity entity) const -> const T* {
+    static_assert(!is_tag_component_v<T>, "Tag components carry no data; use has_component()");
+    
+    if constexpr (is_sparse_component_v<T>) {
+        const auto* set = is_alive(entity) ? sparse_set(component_id<T>()) : nullptr;
+        return set ? std::launder(static_cast<const T*>(set->get(entity))) : nullptr;
+    }
+    
     if (!has_component<T>(entity)) {
         return nullptr;
     }
@@ -441,55 +1464,364 @@ auto World::get_component(Entity entity) const -> const T* {
 
 template<typename T>
 auto World::get_component(Entity entity) -> T* {
+    static_assert(!is_tag_component_v<T>, "Tag components carry no data; use has_component()");
+    
+    if constexpr (is_sparse_component_v<T>) {
+        auto* set = is_alive(entity) ? sparse_set(component_id<T>()) : nullptr;
+        const u32 index = set ? set->index_of(entity) : SparseSet::ABSENT;
+        if (index == SparseSet::ABSENT) {
+            return nullptr;
+        }
+        set->mark_changed(index, change_tick_);  // Mutable access counts as a write
+        return std::launder(static_cast<T*>(set->at(index)));
+    }
+    
     if (!has_component<T>(entity)) {
         return nullptr;
     }
     
     const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
     auto& archetype = archetypes_[meta.archetype_index];
+    archetype->mark_changed(component_id<T>(), meta.entity_index, change_tick_);  // Mutable access counts as a write
     return archetype->get_component<T>(component_id<T>(), meta.entity_index);
 }
 
 template<typename... Components, typename Func>
 auto World::each(Func&& func) const -> void {
-    const ComponentSignature required_sig = compute_signature<Components...>();
+    if constexpr ((is_sparse_component_v<Components> || ...)) {
+        each_with_sparse<const Components...>(func);
+    } else {
+        each_chunk<Components...>([&](std::span<const Entity> entities,
+                                      std::span<const Components>... columns) {
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                func(entities[i], columns[i]...);
+            }
+        });
+    }
+}
+
+template<typename... Components, typename Func>
+auto World::each(Func&& func) -> void {
+    if constexpr ((is_sparse_component_v<Components> || ...)) {
+        each_with_sparse<Components...>(func);
+    } else {
+        each_chunk<Components...>([&](std::span<const Entity> entities,
+                                      std::span<Components>... columns) {
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                func(entities[i], columns[i]...);
+            }
+        });
+    }
+}
+
+template<typename... Components, typename Func>
+auto World::each_chunk(Func&& func) const -> void {
+    static_assert(!(is_sparse_component_v<Components> || ...),
+                  "Chunk iteration covers archetype columns only; use each() for sparse-set components");
+    static_assert(!(is_tag_component_v<Components> || ...),
+                  "Tag components carry no data; filter on them with Query<..., With<Tag>>");
+    
+    const ComponentSignature required_sig = signature_of<Components...>();
+    const std::array<u32, sizeof...(Components)> type_ids{component_id<Components>()...};
     
     // Iterate over all archetypes
-    for (const auto& archetype : archetypes_) {
-        const ComponentSignature arch_sig = archetype->signature();
+    for (const auto& owned_archetype : archetypes_) {
+        const Archetype& archetype = *owned_archetype;  // const view -> read-only spans
         
         // Check if archetype has all required components
-        if ((arch_sig & required_sig) != required_sig) {
+        if (!archetype.signature().contains(required_sig)) {
             continue;
         }
         
-        // Iterate over entities in this archetype
-        for (u32 i = 0; i < archetype->size(); ++i) {
-            const Entity entity = archetype->get_entity(i);
-            func(entity, *archetype->get_component<Components>(component_id<Components>(), i)...);
+        // Column spans are resolved once per chunk (no per-entity lookups)
+        for (std::size_t c = 0; c < archetype.chunk_count(); ++c) {
+            const Chunk& chunk = archetype.chunk(c);
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                func(chunk.entities(), chunk.column<std::remove_const_t<Components>>(type_ids[I])...);
+            }(std::index_sequence_for<Components...>{});
         }
     }
 }
 
 template<typename... Components, typename Func>
-auto World::each(Func&& func) -> void {
-    const ComponentSignature required_sig = compute_signature<Components...>();
+auto World::each_chunk(Func&& func) -> void {
+    static_assert(!(is_sparse_component_v<Components> || ...),
+                  "Chunk iteration covers archetype columns only; use each() for sparse-set components");
+    static_assert(!(is_tag_component_v<Components> || ...),
+                  "Tag components carry no data; filter on them with Query<..., With<Tag>>");
+    
+    const ComponentSignature required_sig = signature_of<Components...>();
+    const std::array<u32, sizeof...(Components)> type_ids{component_id<Components>()...};
     
     // Iterate over all archetypes
     for (auto& archetype : archetypes_) {
-        const ComponentSignature arch_sig = archetype->signature();
-        
         // Check if archetype has all required components
-        if ((arch_sig & required_sig) != required_sig) {
+        if (!archetype->signature().contains(required_sig)) {
             continue;
         }
         
-        // Iterate over entities in this archetype
-        for (u32 i = 0; i < archetype->size(); ++i) {
-            const Entity entity = archetype->get_entity(i);
-            func(entity, *archetype->get_component<Components>(component_id<Components>(), i)...);
+        // Column spans are resolved once per chunk (no per-entity lookups)
+        for (std::size_t c = 0; c < archetype->chunk_count(); ++c) {
+            Chunk& chunk = archetype->chunk(c);
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                func(chunk.entities(), column_span<Components>(chunk, type_ids[I])...);
+            }(std::index_sequence_for<Components...>{});
         }
     }
 }
 
+template<typename... Components, typename Func>
+auto World::par_each(JobSystem& jobs, Func&& func) -> void {
+    if constexpr ((is_sparse_component_v<Components> || ...)) {
+        par_each_with_sparse<Components...>(jobs, func);
+    } else {
+        par_each_chunk<Components...>(jobs, [&](std::span<const Entity> entities,
+                                                std::span<Components>... columns) {
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                func(entities[i], columns[i]...);
+            }
+        });
+    }
+}
+
+template<typename... Components, typename Func>
+auto World::par_each(JobSystem& jobs, Func&& func) const -> void {
+    if constexpr ((is_sparse_component_v<Components> || ...)) {
+        par_each_with_sparse<const Components...>(jobs, func);
+    } else {
+        par_each_chunk<Components...>(jobs, [&](std::span<const Entity> entities,
+                                                std::span<const Components>... columns) {
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                func(entities[i], columns[i]...);
+            }
+        });
+    }
+}
+
+template<typename... Components, typename Func>
+auto World::par_each_chunk(JobSystem& jobs, Func&& func) -> void {
+    static_assert(!(is_sparse_component_v<Components> || ...),
+                  "Chunk iteration covers archetype columns only; use each() for sparse-set components");
+    static_assert(!(is_tag_component_v<Components> || ...),
+                  "Tag components carry no data; filter on them with Query<..., With<Tag>>");
+    
+    const auto chunks = matching_chunks(signature_of<Components...>());
+    const std::array<u32, sizeof...(Components)> type_ids{component_id<Components>()...};
+    
+    // One work item per chunk; each chunk is touched by exactly one job
+    run_parallel(jobs, chunks.size(), [&](std::size_t i) {
+        Chunk& chunk = *chunks[i];
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            func(chunk.entities(), column_span<Components>(chunk, type_ids[I])...);
+        }(std::index_sequence_for<Components...>{});
+    });
+}
+
+template<typename... Components, typename Func>
+auto World::par_each_chunk(JobSystem& jobs, Func&& func) const -> void {
+    static_assert(!(is_sparse_component_v<Components> || ...),
+                  "Chunk iteration covers archetype columns only; use each() for sparse-set components");
+    static_assert(!(is_tag_component_v<Components> || ...),
+                  "Tag components carry no data; filter on them with Query<..., With<Tag>>");
+    
+    const auto chunks = matching_chunks(signature_of<Components...>());
+    const std::array<u32, sizeof...(Components)> type_ids{component_id<Components>()...};
+    
+    run_parallel(jobs, chunks.size(), [&](std::size_t i) {
+        const Chunk& chunk = *chunks[i];  // const view -> read-only spans
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            func(chunk.entities(), chunk.column<std::remove_const_t<Components>>(type_ids[I])...);
+        }(std::index_sequence_for<Components...>{});
+    });
+}
+
+template<typename T, typename Func>
+auto World::each_changed(u32 since_tick, Func&& func) const -> void {
+    using Component = std::remove_const_t<T>;
+    static_assert(!is_tag_component_v<Component>, "Tag components carry no data to change");
+    const u32 type_id = component_id<Component>();
+    
+    if constexpr (is_sparse_component_v<Component>) {
+        if (const auto* set = sparse_set(type_id)) {
+            for (u32 i = 0; i < set->size(); ++i) {
+                if (set->tick(i) > since_tick) {
+                    func(set->entities()[i], *std::launder(static_cast<const Component*>(set->at(i))));
+                }
+            }
+        }
+        return;
+    }
+    
+    for (const auto& owned_archetype : archetypes_) {
+        const Archetype& archetype = *owned_archetype;
+        if (!archetype.has_component_array(type_id)) {
+            continue;
+        }
+        
+        for (std::size_t c = 0; c < archetype.chunk_count(); ++c) {
+            const Chunk& chunk = archetype.chunk(c);
+            if (chunk.changed_tick(type_id) <= since_tick) {
+                continue;  // Nothing in this column changed: skip all rows
+            }
+            
+            const auto entities = chunk.entities();
+            const auto column = chunk.column<Component>(type_id);
+            for (u32 row = 0; row < chunk.size(); ++row) {
+                if (chunk.row_tick(type_id, row) > since_tick) {
+                    func(entities[row], column[row]);
+                }
+            }
+        }
+    }
+}
+
+template<typename Visit>
+auto World::visit_matching(
+    const ComponentSignature& required,
+    const ComponentSignature& excluded,
+    std::span<const u32> sparse_required,
+    std::span<const u32> sparse_excluded,
+    Visit&& visit
+) const -> void {
+    const auto sparse_ok = [&](Entity entity, std::span<const u32> type_ids, bool wanted) {
+        for (const auto type_id : type_ids) {
+            const auto* set = sparse_set(type_id);
+            if ((set && set->contains(entity)) != wanted) {
+                return false;
+            }
+        }
+        return true;
+    };
+    
+    if (!sparse_required.empty()) {
+        // Drive from the smallest required set (a missing set means no matches)
+        const SparseSet* driver = nullptr;
+        for (const auto type_id : sparse_required) {
+            const auto* set = sparse_set(type_id);
+            if (!set || set->size() == 0) {
+                return;
+            }
+            if (!driver || set->size() < driver->size()) {
+                driver = set;
+            }
+        }
+        
+        for (const Entity entity : driver->entities()) {
+            const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+            if (meta.archetype_index == INVALID_ARCHETYPE) {
+                if (!required.empty()) {
+                    continue;
+                }
+            } else {
+                const auto& signature = archetypes_[meta.archetype_index]->signature();
+                if (!signature.contains(required) || signature.intersects(excluded)) {
+                    continue;
+                }
+            }
+            if (sparse_ok(entity, sparse_required, true) && sparse_ok(entity, sparse_excluded, false)) {
+                visit(entity, meta.archetype_index, meta.entity_index);
+            }
+        }
+        return;
+    }
+    
+    for (std::size_t a = 0; a < archetypes_.size(); ++a) {
+        const Archetype& archetype = *archetypes_[a];
+        if (!archetype.signature().contains(required) || archetype.signature().intersects(excluded)) {
+            continue;
+        }
+        
+        u32 row = 0;
+        for (std::size_t c = 0; c < archetype.chunk_count(); ++c) {
+            for (const Entity entity : archetype.chunk(c).entities()) {
+                if (sparse_ok(entity, sparse_excluded, false)) {
+                    visit(entity, static_cast<u32>(a), row);
+                }
+                ++row;
+            }
+        }
+    }
+}
+
+template<typename Component>
+auto World::fetch(u32 type_id, Entity entity, u32 archetype_index, u32 row) const -> Component* {
+    using T = std::remove_const_t<Component>;
+    constexpr bool writable = !std::is_const_v<Component>;
+    
+    if constexpr (is_sparse_component_v<T>) {
+        auto* set = sparse_set(type_id);
+        const u32 index = set ? set->index_of(entity) : SparseSet::ABSENT;
+        if (index == SparseSet::ABSENT) {
+            return nullptr;
+        }
+        if constexpr (writable) {
+            set->mark_changed(index, change_tick_);
+        }
+        return std::launder(static_cast<T*>(set->at(index)));
+    } else {
+        if (archetype_index == INVALID_ARCHETYPE) {
+            return nullptr;
+        }
+        Archetype& archetype = *archetypes_[archetype_index];
+        auto* raw = archetype.component_raw(type_id, row);
+        if (!raw) {
+            return nullptr;
+        }
+        if constexpr (writable) {
+            archetype.mark_changed(type_id, row, change_tick_);
+        }
+        return std::launder(reinterpret_cast<T*>(raw));
+    }
+}
+
+template<typename... Components, typename Func>
+auto World::each_with_sparse(Func&& func) const -> void {
+    static_assert(!(is_tag_component_v<Components> || ...),
+                  "Tag components carry no data; filter on them with Query<..., With<Tag>>");
+    
+    const std::array<u32, sizeof...(Components)> type_ids{component_id<Components>()...};
+    ComponentSignature required;
+    std::vector<u32> sparse_required;
+    split_storage<Components...>(required, sparse_required);
+    
+    visit_matching(required, {}, sparse_required, {}, [&](Entity entity, u32 archetype_index, u32 row) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            func(entity, *fetch<Components>(type_ids[I], entity, archetype_index, row)...);
+        }(std::index_sequence_for<Components...>{});
+    });
+}
+
+template<typename... Components, typename Func>
+auto World::par_each_with_sparse(JobSystem& jobs, Func&& func) const -> void {
+    static_assert(!(is_tag_component_v<Components> || ...),
+                  "Tag components carry no data; filter on them with Query<..., With<Tag>>");
+    
+    const std::array<u32, sizeof...(Components)> type_ids{component_id<Components>()...};
+    ComponentSignature required;
+    std::vector<u32> sparse_required;
+    split_storage<Components...>(required, sparse_required);
+    
+    // Collect matches and stamp writes here: ticks are shared per chunk column
+    struct Match {
+        Entity entity;
+        u32 archetype_index;
+        u32 row;
+    };
+    std::vector<Match> matches;
+    visit_matching(required, {}, sparse_required, {}, [&](Entity entity, u32 archetype_index, u32 row) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (static_cast<void>(fetch<Components>(type_ids[I], entity, archetype_index, row)), ...);
+        }(std::index_sequence_for<Components...>{});
+        matches.push_back(Match{entity, archetype_index, row});
+    });
+    
+    run_parallel(jobs, matches.size(), [&](std::size_t i) {
+        const Match& match = matches[i];
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            func(match.entity, *const_cast<Components*>(
+                fetch<const Components>(type_ids[I], match.entity, match.archetype_index, match.row))...);
+        }(std::index_sequence_for<Components...>{});
+    });
+}
+
 } // namespace luma::scene
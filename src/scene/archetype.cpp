@@ -8,32 +8,311 @@
 
 #include <luma/scene/archetype.hpp>
 
+#include <algorithm>
+#include <utility>
+
 namespace luma::scene {
 
-Archetype::Archetype(ComponentSignature signature)
-    : signature_(signature) {}
+namespace {
+
+/**
+ * @brief Round offset up to alignment (alignment must be a power of two)
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+constexpr auto align_up(std::size_t offset, std::size_t alignment) -> std::size_t {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+} // anonymous namespace
+
+// ========== Chunk ==========
+
+Chunk::Chunk(const Archetype& owner)
+    : owner_(&owner)
+    , data_(static_cast<std::byte*>(
+          ::operator new(owner.chunk_bytes(), std::align_val_t{CHUNK_ALIGNMENT})))
+    , ticks_(std::make_unique<u32[]>(owner.columns().size() * (FIRST_ROW_TICK + owner.chunk_capacity()))) {}
+
+Chunk::~Chunk() {
+    ::operator delete(data_, std::align_val_t{CHUNK_ALIGNMENT});
+}
+
+auto Chunk::fold_bulk_ticks() -> void {
+    for (std::size_t slot = 0; slot < owner_->columns().size(); ++slot) {
+        u32* ticks = tick_block_at(slot);
+        if (ticks[BULK_TICK] == 0) {
+            continue;
+        }
+        for (u32 row = 0; row < count_; ++row) {
+            ticks[FIRST_ROW_TICK + row] = std::max(ticks[BULK_TICK], ticks[FIRST_ROW_TICK + row]);
+        }
+        ticks[BULK_TICK] = 0;
+    }
+}
+
+// ========== Archetype ==========
+
+Archetype::Archetype(ComponentSignature signature, std::vector<ArchetypeColumn> columns)
+    : signature_(std::move(signature))
+    , columns_(std::move(columns)) {
+    // Deterministic layout regardless of the order columns were discovered in
+    std::ranges::sort(columns_, {}, &ArchetypeColumn::type_id);
+    
+    // Dense type ID -> column slot table (O(1) lookup for any registered type)
+    const u32 max_type_id = columns_.empty() ? 0 : columns_.back().type_id;
+    column_index_.assign(columns_.empty() ? 0 : max_type_id + 1, NO_COLUMN);
+    for (std::size_t slot = 0; slot < columns_.size(); ++slot) {
+        column_index_[columns_[slot].type_id] = static_cast<u8>(slot);
+    }
+    
+    compute_layout();
+}
+
+Archetype::~Archetype() {
+    for (auto& chunk : chunks_) {
+        for (u32 row = 0; row < chunk->count_; ++row) {
+            destroy_row(*chunk, row);
+        }
+    }
+}
+
+auto Archetype::compute_layout() -> void {
+    // Bytes needed for `capacity` rows, including alignment padding between blocks
+    const auto bytes_for = [this](std::size_t capacity) {
+        std::size_t offset = sizeof(Entity) * capacity;
+        for (const auto& col : columns_) {
+            offset = align_up(offset, col.info.alignment) + std::size_t{col.info.size} * capacity;
+        }
+        return offset;
+    };
+    
+    // Upper bound from per-row size, then shrink until padding fits too
+    std::size_t row_bytes = sizeof(Entity);
+    for (const auto& col : columns_) {
+        row_bytes += col.info.size;
+    }
+    std::size_t capacity = std::max<std::size_t>(CHUNK_SIZE / row_bytes, 1);
+    while (capacity > 1 && bytes_for(capacity) > CHUNK_SIZE) {
+        --capacity;
+    }
+    
+    chunk_capacity_ = static_cast<u32>(capacity);
+    chunk_bytes_ = std::max(CHUNK_SIZE, align_up(bytes_for(capacity), CHUNK_ALIGNMENT));
+    
+    // Assign column offsets (entity list occupies the start of the chunk)
+    std::size_t offset = sizeof(Entity) * capacity;
+    for (auto& col : columns_) {
+        offset = align_up(offset, col.info.alignment);
+        col.offset = static_cast<u32>(offset);
+        offset += std::size_t{col.info.size} * capacity;
+    }
+}
 
 auto Archetype::add_entity(Entity entity) -> u32 {
-    const auto index = static_cast<u32>(entities_.size());
-    entities_.push_back(entity);
-    return index;
+    // Start a new chunk when the last one is full (reuse the spare if we have one)
+    if (chunks_.empty() || chunks_.back()->count_ == chunk_capacity_) {
+        if (spare_chunk_) {
+            // Recycled chunk must not report its previous rows' changes
+            std::fill_n(spare_chunk_->ticks_.get(), columns_.size() * (Chunk::FIRST_ROW_TICK + chunk_capacity_), 0u);
+            chunks_.push_back(std::move(spare_chunk_));
+        } else {
+            chunks_.push_back(std::make_unique<Chunk>(*this));
+        }
+    }
+    
+    auto& chunk = *chunks_.back();
+    ::new (chunk.data_ + sizeof(Entity) * chunk.count_) Entity(entity);
+    ++chunk.count_;
+    
+    return size_++;
 }
 
 auto Archetype::remove_entity(u32 index) -> Entity {
-    if (index >= entities_.size()) {
+    if (index >= size_) {
         return NULL_ENTITY;
     }
     
-    // Get entity that will be swapped into this position
-    const auto swapped_entity = (index < entities_.size() - 1) ? entities_.back() : NULL_ENTITY;
+    destroy_row(*chunks_[index / chunk_capacity_], index % chunk_capacity_);
+    return release_entity(index);
+}
+
+auto Archetype::release_entity(u32 index) -> Entity {
+    if (index >= size_) {
+        return NULL_ENTITY;
+    }
     
-    // Swap-and-pop
-    if (index < entities_.size() - 1) {
-        entities_[index] = entities_.back();
+    auto& chunk = *chunks_[index / chunk_capacity_];
+    const auto row = index % chunk_capacity_;
+    auto& last_chunk = *chunks_.back();
+    const auto last_row = last_chunk.count_ - 1;
+    
+    // Swap-and-pop: relocate last row into the hole
+    auto swapped_entity = NULL_ENTITY;
+    if (index != size_ - 1) {
+        for (std::size_t slot = 0; slot < columns_.size(); ++slot) {
+            const auto& col = columns_[slot];
+            std::byte* dst = chunk.data_ + col.offset + std::size_t{col.info.size} * row;
+            std::byte* src = last_chunk.data_ + col.offset + std::size_t{col.info.size} * last_row;
+            col.info.relocate_to(dst, src);
+            
+            // Moved row keeps its change tick
+            const u32* src_ticks = last_chunk.tick_block_at(slot);
+            u32* dst_ticks = chunk.tick_block_at(slot);
+            dst_ticks[Chunk::FIRST_ROW_TICK + row] = std::max(src_ticks[Chunk::BULK_TICK],
+                                                              src_ticks[Chunk::FIRST_ROW_TICK + last_row]);
+            dst_ticks[Chunk::CHANGED_TICK] = std::max(dst_ticks[Chunk::CHANGED_TICK],
+                                                      dst_ticks[Chunk::FIRST_ROW_TICK + row]);
+        }
+        swapped_entity = last_chunk.entities()[last_row];
+        *std::launder(reinterpret_cast<Entity*>(chunk.data_) + row) = swapped_entity;
+    }
+    
+    --last_chunk.count_;
+    --size_;
+    
+    // Release emptied trailing chunk (keep one around as a spare)
+    if (last_chunk.count_ == 0) {
+        if (!spare_chunk_) {
+            spare_chunk_ = std::move(chunks_.back());
+        }
+        chunks_.pop_back();
     }
-    entities_.pop_back();
     
     return swapped_entity;
 }
 
+auto Archetype::mark_row_changed(u32 index, u32 tick) -> void {
+    if (index >= size_) {
+        return;
+    }
+    auto& chunk = *chunks_[index / chunk_capacity_];
+    const auto row = index % chunk_capacity_;
+    for (std::size_t slot = 0; slot < columns_.size(); ++slot) {
+        u32* ticks = chunk.tick_block_at(slot);
+        ticks[Chunk::FIRST_ROW_TICK + row] = tick;
+        ticks[Chunk::CHANGED_TICK] = std::max(ticks[Chunk::CHANGED_TICK], tick);
+    }
+}
+
+auto Archetype::component_raw(u32 type_id, u32 index) const -> std::byte* {
+    const auto* col = column(type_id);
+    if (!col || index >= size_) {
+        return nullptr;
+    }
+    const auto& chunk = *chunks_[index / chunk_capacity_];
+    return chunk.data_ + col->offset + std::size_t{col->info.size} * (index % chunk_capacity_);
+}
+
+auto Archetype::set_add_edge(u32 type_id, u32 archetype_index) -> void {
+    if (type_id >= add_edges_.size()) {
+        add_edges_.resize(type_id + 1, INVALID_ARCHETYPE);
+    }
+    add_edges_[type_id] = archetype_index;
+}
+
+auto Archetype::set_remove_edge(u32 type_id, u32 archetype_index) -> void {
+    if (type_id >= remove_edges_.size()) {
+        remove_edges_.resize(type_id + 1, INVALID_ARCHETYPE);
+    }
+    remove_edges_[type_id] = archetype_index;
+}
+
+auto Archetype::remap_edges(std::span<const u32> remap) -> void {
+    const auto apply = [remap](u32& edge) {
+        edge = edge < remap.size() ? remap[edge] : INVALID_ARCHETYPE;
+    };
+    std::ranges::for_each(add_edges_, apply);
+    std::ranges::for_each(remove_edges_, apply);
+}
+
+auto Archetype::shrink() -> void {
+    spare_chunk_.reset();
+    chunks_.shrink_to_fit();
+    add_edges_.shrink_to_fit();
+    remove_edges_.shrink_to_fit();
+}
+
+auto Archetype::reorder(std::span<const u32> order) -> void {
+    // Relocate into new chunks in the requested order, then swap chunk lists.
+    // Costs one archetype's worth of memory while it runs; the old chunks
+    // are freed right after.
+    std::vector<std::unique_ptr<Chunk>> packed;
+    packed.reserve(chunks_.size());
+    
+    for (u32 index = 0; index < order.size(); ++index) {
+        if (index % chunk_capacity_ == 0) {
+            packed.push_back(std::make_unique<Chunk>(*this));
+        }
+        auto& dst = *packed.back();
+        const u32 dst_row = dst.count_++;
+        auto& src = *chunks_[order[index] / chunk_capacity_];
+        const u32 src_row = order[index] % chunk_capacity_;
+        
+        ::new (dst.data_ + sizeof(Entity) * dst_row) Entity(src.entities()[src_row]);
+        for (std::size_t slot = 0; slot < columns_.size(); ++slot) {
+            const auto& col = columns_[slot];
+            col.info.relocate_to(dst.data_ + col.offset + std::size_t{col.info.size} * dst_row,
+                                 src.data_ + col.offset + std::size_t{col.info.size} * src_row);
+            
+            // Moved row keeps its change tick (column-wide writes fold into it)
+            const u32* src_ticks = src.tick_block_at(slot);
+            u32* dst_ticks = dst.tick_block_at(slot);
+            dst_ticks[Chunk::FIRST_ROW_TICK + dst_row] = std::max(src_ticks[Chunk::BULK_TICK],
+                                                                  src_ticks[Chunk::FIRST_ROW_TICK + src_row]);
+            dst_ticks[Chunk::CHANGED_TICK] = std::max(dst_ticks[Chunk::CHANGED_TICK],
+                                                      dst_ticks[Chunk::FIRST_ROW_TICK + dst_row]);
+        }
+    }
+    
+    // Old rows were relocated out: drop the chunks without destroying rows
+    for (auto& chunk : chunks_) {
+        chunk->count_ = 0;
+    }
+    chunks_ = std::move(packed);
+}
+
+auto Archetype::swap_rows(u32 a, u32 b) -> void {
+    if (a == b || a >= size_ || b >= size_) {
+        return;
+    }
+    
+    auto& chunk_a = *chunks_[a / chunk_capacity_];
+    auto& chunk_b = *chunks_[b / chunk_capacity_];
+    const u32 row_a = a % chunk_capacity_;
+    const u32 row_b = b % chunk_capacity_;
+    chunk_a.fold_bulk_ticks();
+    chunk_b.fold_bulk_ticks();
+    
+    auto* entities_a = std::launder(reinterpret_cast<Entity*>(chunk_a.data_));
+    auto* entities_b = std::launder(reinterpret_cast<Entity*>(chunk_b.data_));
+    std::swap(entities_a[row_a], entities_b[row_b]);
+    
+    for (std::size_t slot = 0; slot < columns_.size(); ++slot) {
+        const auto& col = columns_[slot];
+        std::byte* pa = chunk_a.data_ + col.offset + std::size_t{col.info.size} * row_a;
+        std::byte* pb = chunk_b.data_ + col.offset + std::size_t{col.info.size} * row_b;
+        if (col.info.trivially_relocatable) {
+            std::swap_ranges(pa, pa + col.info.size, pb);
+        } else {
+            // Three relocations through an aligned temporary
+            void* scratch = ::operator new(col.info.size, std::align_val_t{col.info.alignment});
+            col.info.relocate_to(scratch, pa);
+            col.info.relocate_to(pa, pb);
+            col.info.relocate_to(pb, scratch);
+            ::operator delete(scratch, std::align_val_t{col.info.alignment});
+        }
+        
+        // Ticks are per row after folding: swap them with the data
+        std::swap(chunk_a.tick_block_at(slot)[Chunk::FIRST_ROW_TICK + row_a],
+                  chunk_b.tick_block_at(slot)[Chunk::FIRST_ROW_TICK + row_b]);
+    }
+}
+
+auto Archetype::destroy_row(Chunk& chunk, u32 row) -> void {
+    for (const auto& col : columns_) {
+        col.info.destroy(chunk.data_ + col.offset + std::size_t{col.info.size} * row);
+    }
+}
+
 } // namespace luma::scene
@@ -0,0 +1,853 @@
+/**
+ * @file binary_scene.cpp
+ * @brief Binary scene format (.lscene) implementation
+ * 
+ * Writing streams column data straight from archetype chunks to the file
+ * and appends the tables at the end; reading maps the file, validates every
+ * table and data range, then copies column slices into freshly spawned
+ * chunks (World::spawn_columns()).
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/binary_scene.hpp>
+#include <luma/scene/reflection.hpp>
+#include <luma/scene/registry.hpp>
+#include <luma/core/logging.hpp>
+
+#include "scene_components.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace luma::scene {
+
+namespace {
+
+using detail::ComponentScratch;
+using detail::SceneComponent;
+using detail::scene_components;
+
+// ========== File Records ==========
+
+constexpr std::array<char, 8> SCENE_MAGIC{'L', 'S', 'C', 'E', 'N', 'E', '\0', '\0'};
+constexpr u32 BYTE_ORDER_MARK = 0x01020304;  ///< Reads back differently on a foreign-endian host
+constexpr u64 COLUMN_ALIGNMENT = 64;  ///< Column data alignment inside the file
+constexpr u32 NO_ENTITY_TABLE = 0;
+
+/**
+ * @brief Fixed-size file header (offset 0)
+ */
+struct SceneFileHeader {
+    std::array<char, 8> magic;  ///< SCENE_MAGIC
+    u32 version;  ///< BINARY_SCENE_VERSION
+    u32 byte_order;  ///< BYTE_ORDER_MARK as written by the saving host
+    u64 file_size;  ///< Total file size in bytes
+    u64 entity_count;  ///< Entities in the file (block rows + loose entities)
+    u64 loose_entities;  ///< Entities that live in no archetype block (numbered last)
+    u64 component_table;  ///< Offset of ComponentRecord[component_count]
+    u64 block_table;  ///< Offset of BlockRecord[block_count]
+    u64 column_table;  ///< Offset of ColumnRecord[column_count]
+    u64 name_table;  ///< Offset of the component name bytes
+    u64 name_bytes;  ///< Size of the component name bytes
+    u32 component_count;  ///< Number of ComponentRecords
+    u32 block_count;  ///< Number of BlockRecords
+    u32 column_count;  ///< Number of ColumnRecords
+    u32 reserved;  ///< Zero
+};
+
+/**
+ * @brief Component type referenced by the file
+ */
+struct ComponentRecord {
+    u64 layout_hash;  ///< layout_hash() of the type when written
+    u32 name_offset;  ///< Offset of the name inside the name table
+    u32 name_length;  ///< Name length in bytes
+};
+
+/**
+ * @brief Block kind
+ */
+enum class BlockKind : u32 {
+    ARCHETYPE,  ///< Rows of one archetype: one column per component
+    SPARSE,  ///< Values of one sparse-set component plus their entity indices
+};
+
+/**
+ * @brief Group of entities stored column by column
+ */
+struct BlockRecord {
+    u64 row_count;  ///< Rows in the block
+    u64 entity_table;  ///< SPARSE: offset of u32[row_count] file entity indices
+    u32 first_column;  ///< First ColumnRecord of the block
+    u32 column_count;  ///< Number of ColumnRecords of the block
+    BlockKind kind;  ///< Block kind
+    u32 reserved;  ///< Zero
+};
+
+/**
+ * @brief How a column's values are encoded
+ */
+enum class ColumnEncoding : u32 {
+    RAW,  ///< row_count * size bytes, copied as-is (trivially copyable, unpadded, no bool fields)
+    FIELDS,  ///< row_count write_fields() records
+    NONE,  ///< Tag: presence only, no data
+};
+
+/**
+ * @brief One component column of a block
+ */
+struct ColumnRecord {
+    u64 offset;  ///< Offset of the column data (COLUMN_ALIGNMENT aligned)
+    u64 bytes;  ///< Size of the column data
+    u32 component;  ///< Index into the component table
+    ColumnEncoding encoding;  ///< Value encoding
+};
+
+static_assert(std::is_trivially_copyable_v<SceneFileHeader> && sizeof(SceneFileHeader) == 96);
+static_assert(std::is_trivially_copyable_v<ComponentRecord> && sizeof(ComponentRecord) == 16);
+static_assert(std::is_trivially_copyable_v<BlockRecord> && sizeof(BlockRecord) == 32);
+static_assert(std::is_trivially_copyable_v<ColumnRecord> && sizeof(ColumnRecord) == 24);
+
+// ========== Component Layouts ==========
+
+/**
+ * @brief FNV-1a fingerprint of everything a stored column depends on
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * Covers size, alignment, storage policy, copyability and every reflected
+ * field's name, type and offset; a change to any of them invalidates files.
+ */
+auto layout_hash(const ComponentTypeInfo& info, std::span<const FieldInfo> fields) -> u64 {
+    u64 hash = 0xcbf29ce484222325ull;
+    const auto mix = [&hash](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        }
+    };
+    const auto mix_value = [&mix](u64 value) { mix(&value, sizeof(value)); };
+    
+    mix_value(info.size);
+    mix_value(info.alignment);
+    mix_value(static_cast<u64>(info.storage));
+    mix_value(info.trivially_relocatable ? 1 : 0);
+    for (const auto& field : fields) {
+        mix(field.name.data(), field.name.size());
+        mix_value(field.offset);
+        mix_value(static_cast<u64>(field.type));
+    }
+    return hash;
+}
+
+/**
+ * @brief Column encoding used for a component
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * Rows are copied as raw bytes only when those bytes are exactly the
+ * reflected state: the fields cover the whole object (no padding bytes
+ * leak into the file) and none is a bool (a file byte other than 0 or 1
+ * would load as an invalid bool). Everything else goes through the field
+ * table.
+ */
+auto encoding_of(const ComponentTypeInfo& info, std::span<const FieldInfo> fields) -> ColumnEncoding {
+    if (info.storage == StoragePolicy::TAG) {
+        return ColumnEncoding::NONE;
+    }
+    u64 covered = 0;
+    for (const auto& field : fields) {
+        if (field.type == FieldType::BOOL) {
+            return ColumnEncoding::FIELDS;
+        }
+        covered += field_size(field.type);
+    }
+    return info.trivially_relocatable && covered == info.size ? ColumnEncoding::RAW : ColumnEncoding::FIELDS;
+}
+
+// ========== Writing ==========
+
+/**
+ * @brief Sequential binary file writer that tracks its position
+ * 
+ * ⚠️ IMPURE CLASS (file I/O)
+ */
+class FileWriter {
+public:
+    explicit FileWriter(const std::filesystem::path& path)
+        : file_(path, std::ios::binary | std::ios::trunc) {}
+    
+    [[nodiscard]] auto is_open() const -> bool { return file_.is_open(); }
+    [[nodiscard]] auto good() const -> bool { return file_.good(); }
+    [[nodiscard]] auto position() const -> u64 { return position_; }
+    
+    auto write(const void* data, std::size_t size) -> void {
+        file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        position_ += size;
+    }
+    
+    template<typename T>
+    auto write_records(const std::vector<T>& records) -> void {
+        write(records.data(), records.size() * sizeof(T));
+    }
+    
+    /**
+     * @brief Zero-pad up to the next multiple of `alignment`
+     */
+    auto align(u64 alignment) -> void {
+        static constexpr std::array<char, COLUMN_ALIGNMENT> zeros{};
+        write(zeros.data(), (alignment - position_ % alignment) % alignment);
+    }
+    
+    /**
+     * @brief Overwrite bytes at the start of the file (header patch)
+     */
+    auto patch_front(const void* data, std::size_t size) -> void {
+        file_.seekp(0);
+        file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+private:
+    std::ofstream file_;  ///< Output stream
+    u64 position_{0};  ///< Bytes written so far
+};
+
+// ========== Reading ==========
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ * 
+ * ⚠️ IMPURE CLASS (owns an OS mapping)
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) {
+            return;
+        }
+        mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) {
+            return;
+        }
+        data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+        size_ = data_ ? static_cast<std::size_t>(size.QuadPart) : 0;
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat status{};
+        if (::fstat(fd, &status) == 0 && status.st_size > 0) {
+            void* data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                data_ = data;
+                size_ = static_cast<std::size_t>(status.st_size);
+                ::madvise(data_, size_, MADV_SEQUENTIAL);  // Columns are read front to back
+            }
+        }
+        ::close(fd);  // The mapping keeps the file alive
+#endif
+    }
+    
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+#else
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+#endif
+    }
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    [[nodiscard]] auto is_open() const -> bool { return data_ != nullptr; }
+    
+    [[nodiscard]] auto bytes() const -> std::span<const std::byte> {
+        return {static_cast<const std::byte*>(data_), size_};
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE file_{INVALID_HANDLE_VALUE};  ///< File handle
+    HANDLE mapping_{nullptr};  ///< File mapping object
+#endif
+    void* data_{nullptr};  ///< Start of the mapping (page aligned)
+    std::size_t size_{0};  ///< Mapped bytes
+};
+
+/**
+ * @brief Check that [offset, offset + size) lies inside a buffer
+ * 
+ * ✨ PURE FUNCTION ✨ (overflow safe)
+ */
+auto in_range(std::span<const std::byte> file, u64 offset, u64 size) -> bool {
+    return offset <= file.size() && size <= file.size() - offset;
+}
+
+/**
+ * @brief Copy a table of records out of the file
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * Copying (rather than casting the mapping) keeps the reads alignment safe;
+ * the tables are tiny next to the column data.
+ */
+template<typename T>
+auto read_records(std::span<const std::byte> file, u64 offset, u64 count) -> std::optional<std::vector<T>> {
+    if (count > file.size() / sizeof(T) || !in_range(file, offset, count * sizeof(T))) {
+        return std::nullopt;
+    }
+    std::vector<T> records(static_cast<std::size_t>(count));
+    std::memcpy(records.data(), file.data() + offset, records.size() * sizeof(T));
+    return records;
+}
+
+/**
+ * @brief Component of the file, resolved against the registry
+ */
+struct ResolvedComponent {
+    u32 type_id{INVALID_COMPONENT};  ///< Registry ID (INVALID_COMPONENT: unknown, skipped)
+    std::span<const FieldInfo> fields;  ///< Reflected fields
+    ComponentTypeInfo info;  ///< Operations table
+};
+
+/**
+ * @brief Column whose data is copied into the world
+ */
+struct ColumnSource {
+    const ResolvedComponent* component;  ///< Resolved type
+    ColumnEncoding encoding;  ///< Value encoding
+    std::span<const std::byte> data;  ///< Column data inside the mapping
+    std::size_t cursor{0};  ///< FIELDS: read position of the next record
+};
+
+/**
+ * @brief Construct `count` components from a column into contiguous storage
+ * 
+ * ⚠️ IMPURE (constructs objects at dst, advances source.cursor)
+ * 
+ * @param source Validated column
+ * @param dst Uninitialized storage for `count` components
+ * @param first Index of the first row within the column
+ * @param count Number of rows
+ */
+auto fill_column(ColumnSource& source, std::byte* dst, u64 first, u64 count) -> void {
+    const auto& info = source.component->info;
+    if (source.encoding == ColumnEncoding::RAW) {
+        std::memcpy(dst, source.data.data() + first * info.size, count * info.size);
+        return;
+    }
+    for (u64 i = 0; i < count; ++i) {
+        void* object = dst + i * info.size;
+        info.default_construct(object);
+        source.cursor += *read_fields(source.component->fields, object, source.data.subspan(source.cursor));
+    }
+}
+
+/**
+ * @brief Lower-case file extension
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto extension_of(const std::filesystem::path& path) -> std::string {
+    auto extension = path.extension().string();
+    std::ranges::transform(extension, extension.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return extension;
+}
+
+/**
+ * @brief Scene file formats convert_scene() knows
+ */
+enum class SceneFormat { YAML, BINARY, UNKNOWN };
+
+auto format_of(const std::filesystem::path& path) -> SceneFormat {
+    const auto extension = extension_of(path);
+    if (extension == ".yaml" || extension == ".yml") {
+        return SceneFormat::YAML;
+    }
+    return extension == ".lscene" ? SceneFormat::BINARY : SceneFormat::UNKNOWN;
+}
+
+} // anonymous namespace
+
+auto save_binary_scene(
+    const World& world,
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError> {
+    LOG_INFO("Saving binary scene to: {}", path.string());
+    
+    if (const auto parent = path.parent_path(); !parent.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(parent, ec);
+        if (ec) {
+            LOG_ERROR("Failed to create directory: {}", ec.message());
+            return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+        }
+    }
+    
+    FileWriter out(path);
+    if (!out.is_open()) {
+        LOG_ERROR("Failed to open file for writing: {}", path.string());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    
+    SceneFileHeader header{};
+    out.write(&header, sizeof(header));  // Patched once the tables are known
+    
+    const auto components = scene_components();
+    std::vector<ComponentRecord> component_records;
+    std::vector<BlockRecord> blocks;
+    std::vector<ColumnRecord> columns;
+    std::string names;
+    std::vector<u32> file_component(ComponentRegistry::instance().size(), INVALID_COMPONENT);
+    const auto file_index_of = [&](std::size_t index) {
+        const auto& component = components[index];
+        if (file_component[component.type_id] == INVALID_COMPONENT) {
+            file_component[component.type_id] = static_cast<u32>(component_records.size());
+            component_records.push_back({
+                .layout_hash = layout_hash(component.info, component.fields),
+                .name_offset = static_cast<u32>(names.size()),
+                .name_length = static_cast<u32>(component.name.size()),
+            });
+            names += component.name;
+        }
+        return file_component[component.type_id];
+    };
+    const bool any_sparse = std::ranges::any_of(components, [](const SceneComponent& component) {
+        return component.info.storage == StoragePolicy::SPARSE;
+    });
+    
+    // Archetype blocks: rows in chunk order, one contiguous column per component
+    std::unordered_map<Entity, u32> file_entity;  // Only needed to reference sparse owners
+    u64 entity_count = 0;
+    std::vector<std::byte> encoded;
+    for (std::size_t a = 0; a < world.archetype_count(); ++a) {
+        const Archetype& archetype = world.archetype(a);
+        if (archetype.size() == 0) {
+            continue;
+        }
+        
+        BlockRecord block{
+            .row_count = archetype.size(),
+            .entity_table = NO_ENTITY_TABLE,
+            .first_column = static_cast<u32>(columns.size()),
+            .column_count = 0,
+            .kind = BlockKind::ARCHETYPE,
+            .reserved = 0,
+        };
+        for (std::size_t c = 0; c < components.size(); ++c) {
+            const auto& component = components[c];
+            if (component.info.storage == StoragePolicy::SPARSE || !archetype.signature().test(component.type_id)) {
+                continue;
+            }
+            
+            out.align(COLUMN_ALIGNMENT);
+            ColumnRecord column{
+                .offset = out.position(),
+                .bytes = 0,
+                .component = file_index_of(c),
+                .encoding = encoding_of(component.info, component.fields),
+            };
+            for (std::size_t k = 0; k < archetype.chunk_count() && column.encoding != ColumnEncoding::NONE; ++k) {
+                const Chunk& chunk = archetype.chunk(k);
+                const std::byte* rows = chunk.column_raw(component.type_id);
+                if (column.encoding == ColumnEncoding::RAW) {
+                    out.write(rows, std::size_t{chunk.size()} * component.info.size);
+                } else {
+                    encoded.clear();
+                    for (u32 row = 0; row < chunk.size(); ++row) {
+                        write_fields(component.fields, rows + std::size_t{row} * component.info.size, encoded);
+                    }
+                    out.write(encoded.data(), encoded.size());
+                }
+            }
+            column.bytes = out.position() - column.offset;
+            columns.push_back(column);
+            ++block.column_count;
+        }
+        if (block.column_count == 0) {
+            continue;  // Nothing serializable in this archetype
+        }
+        
+        if (any_sparse) {
+            for (std::size_t k = 0; k < archetype.chunk_count(); ++k) {
+                for (const Entity entity : archetype.chunk(k).entities()) {
+                    file_entity.emplace(entity, static_cast<u32>(entity_count++));
+                }
+            }
+        } else {
+            entity_count += block.row_count;
+        }
+        blocks.push_back(block);
+    }
+    
+    // Sparse blocks: owners outside every archetype block are numbered last
+    struct SparseBlock {
+        std::size_t component;
+        std::vector<u32> owners;
+        std::vector<const void*> values;
+    };
+    std::vector<SparseBlock> sparse_blocks;
+    u64 loose_entities = 0;
+    if (any_sparse) {
+        const auto alive = world.entities();
+        for (std::size_t c = 0; c < components.size(); ++c) {
+            if (components[c].info.storage != StoragePolicy::SPARSE) {
+                continue;
+            }
+            SparseBlock sparse{.component = c, .owners = {}, .values = {}};
+            for (const Entity entity : alive) {
+                const void* value = world.get_component_by_id(entity, components[c].type_id);
+                if (!value) {
+                    continue;
+                }
+                const auto [it, inserted] = file_entity.emplace(entity, static_cast<u32>(entity_count));
+                if (inserted) {
+                    ++entity_count;
+                    ++loose_entities;
+                }
+                sparse.owners.push_back(it->second);
+                sparse.values.push_back(value);
+            }
+            if (!sparse.owners.empty()) {
+                sparse_blocks.push_back(std::move(sparse));
+            }
+        }
+    }
+    for (const auto& sparse : sparse_blocks) {
+        const auto& component = components[sparse.component];
+        out.align(COLUMN_ALIGNMENT);
+        BlockRecord block{
+            .row_count = sparse.owners.size(),
+            .entity_table = out.position(),
+            .first_column = static_cast<u32>(columns.size()),
+            .column_count = 1,
+            .kind = BlockKind::SPARSE,
+            .reserved = 0,
+        };
+        out.write_records(sparse.owners);
+        
+        out.align(COLUMN_ALIGNMENT);
+        ColumnRecord column{
+            .offset = out.position(),
+            .bytes = 0,
+            .component = file_index_of(sparse.component),
+            .encoding = encoding_of(component.info, component.fields),
+        };
+        encoded.clear();
+        for (const void* value : sparse.values) {
+            if (column.encoding == ColumnEncoding::RAW) {
+                const auto* bytes = static_cast<const std::byte*>(value);
+                encoded.insert(encoded.end(), bytes, bytes + component.info.size);
+            } else {
+                write_fields(component.fields, value, encoded);
+            }
+        }
+        out.write(encoded.data(), encoded.size());
+        column.bytes = out.position() - column.offset;
+        columns.push_back(column);
+        blocks.push_back(block);
+    }
+    
+    // Tables last, then patch the header
+    out.align(alignof(u64));
+    header.component_table = out.position();
+    out.write_records(component_records);
+    header.block_table = out.position();
+    out.write_records(blocks);
+    header.column_table = out.position();
+    out.write_records(columns);
+    header.name_table = out.position();
+    out.write(names.data(), names.size());
+    
+    header.magic = SCENE_MAGIC;
+    header.version = BINARY_SCENE_VERSION;
+    header.byte_order = BYTE_ORDER_MARK;
+    header.file_size = out.position();
+    header.entity_count = entity_count;
+    header.loose_entities = loose_entities;
+    header.name_bytes = names.size();
+    header.component_count = static_cast<u32>(component_records.size());
+    header.block_count = static_cast<u32>(blocks.size());
+    header.column_count = static_cast<u32>(columns.size());
+    out.patch_front(&header, sizeof(header));
+    
+    if (!out.good()) {
+        LOG_ERROR("Failed to write binary scene: {}", path.string());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    LOG_INFO("Binary scene saved successfully ({} entities, {} bytes)", entity_count, header.file_size);
+    return {};
+}
+
+auto load_binary_scene(
+    World& world,
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError> {
+    LOG_INFO("Loading binary scene from: {}", path.string());
+    
+    if (!std::filesystem::exists(path)) {
+        LOG_ERROR("Scene file not found: {}", path.string());
+        return std::unexpected(SerializationError::FILE_NOT_FOUND);
+    }
+    const MappedFile mapping(path);
+    if (!mapping.is_open()) {
+        LOG_ERROR("Failed to map scene file: {}", path.string());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    const auto file = mapping.bytes();
+    const auto corrupt = [&path](const char* what) {
+        LOG_ERROR("Corrupt binary scene {}: {}", path.string(), what);
+        return std::unexpected(SerializationError::CORRUPT_FILE);
+    };
+    
+    // ---- Header ----
+    SceneFileHeader header{};
+    if (file.size() < sizeof(header)) {
+        return corrupt("file smaller than header");
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != SCENE_MAGIC) {
+        return corrupt("bad magic");
+    }
+    if (header.version != BINARY_SCENE_VERSION || header.byte_order != BYTE_ORDER_MARK) {
+        LOG_ERROR("Unsupported binary scene version {} (byte order {:#x})", header.version, header.byte_order);
+        return std::unexpected(SerializationError::UNSUPPORTED_VERSION);
+    }
+    if (header.file_size != file.size()) {
+        return corrupt("size mismatch (truncated?)");
+    }
+    
+    const auto component_records = read_records<ComponentRecord>(file, header.component_table, header.component_count);
+    const auto blocks = read_records<BlockRecord>(file, header.block_table, header.block_count);
+    const auto columns = read_records<ColumnRecord>(file, header.column_table, header.column_count);
+    if (!component_records || !blocks || !columns || !in_range(file, header.name_table, header.name_bytes)) {
+        return corrupt("table out of range");
+    }
+    
+    // ---- Components: resolve by name, refuse changed layouts ----
+    const auto& registry = ComponentRegistry::instance();
+    std::vector<ResolvedComponent> resolved(component_records->size());
+    std::unordered_set<std::string_view> names;
+    for (std::size_t i = 0; i < resolved.size(); ++i) {
+        const auto& record = (*component_records)[i];
+        if (u64{record.name_offset} + record.name_length > header.name_bytes) {
+            return corrupt("component name out of range");
+        }
+        const std::string_view name(
+            reinterpret_cast<const char*>(file.data() + header.name_table + record.name_offset), record.name_length);
+        if (!names.insert(name).second) {
+            return corrupt("component listed twice");  // Two records would resolve to one type
+        }
+        const u32 type_id = registry.find(name);
+        if (type_id == INVALID_COMPONENT) {
+            LOG_WARN("Unknown component '{}' in binary scene, skipping", name);
+            continue;
+        }
+        const auto fields = registry.fields(type_id);
+        const auto info = registry.info(type_id);
+        if (layout_hash(info, fields) != record.layout_hash) {
+            LOG_ERROR("Component '{}' changed since {} was written; rebuild it from its source scene",
+                      name, path.string());
+            return std::unexpected(SerializationError::COMPONENT_LAYOUT_MISMATCH);
+        }
+        resolved[i] = {type_id, fields, info};
+    }
+    
+    // ---- Blocks and columns: every range and record checked up front ----
+    if (header.entity_count > ENTITY_ID_MASK) {
+        return corrupt("more entities than a world can hold");
+    }
+    u64 block_rows = 0;
+    std::vector<std::size_t> listed_in(resolved.size(), blocks->size());  // Component -> last block using it
+    for (std::size_t b = 0; b < blocks->size(); ++b) {
+        const auto& block = (*blocks)[b];
+        if (block.column_count == 0 || block.first_column > columns->size()
+            || block.column_count > columns->size() - block.first_column) {
+            return corrupt("block columns out of range");  // The writer never emits an empty block
+        }
+        if (block.kind == BlockKind::ARCHETYPE) {
+            if (block.row_count > header.entity_count - block_rows) {
+                return corrupt("block rows exceed entity count");
+            }
+            block_rows += block.row_count;
+        } else if (block.kind == BlockKind::SPARSE) {
+            if (block.column_count != 1 || block.row_count > file.size() / sizeof(u32)
+                || !in_range(file, block.entity_table, block.row_count * sizeof(u32))) {
+                return corrupt("sparse block out of range");
+            }
+            for (u64 row = 0; row < block.row_count; ++row) {
+                u32 owner = 0;
+                std::memcpy(&owner, file.data() + block.entity_table + row * sizeof(u32), sizeof(owner));
+                if (owner >= header.entity_count) {
+                    return corrupt("sparse owner out of range");
+                }
+            }
+        } else {
+            return corrupt("unknown block kind");
+        }
+        
+        for (u32 c = block.first_column; c < block.first_column + block.column_count; ++c) {
+            const auto& column = (*columns)[c];
+            if (column.component >= resolved.size() || !in_range(file, column.offset, column.bytes)) {
+                return corrupt("column out of range");
+            }
+            if (listed_in[column.component] == b) {
+                return corrupt("component has two columns in one block");
+            }
+            listed_in[column.component] = b;
+            const auto& component = resolved[column.component];
+            if (component.type_id == INVALID_COMPONENT) {
+                continue;  // Skipped on load
+            }
+            if (column.encoding != encoding_of(component.info, component.fields)
+                || (block.kind == BlockKind::ARCHETYPE) == (component.info.storage == StoragePolicy::SPARSE)) {
+                return corrupt("column encoding does not match component");
+            }
+            if (column.encoding == ColumnEncoding::RAW) {
+                if (block.row_count > column.bytes / std::max<u32>(component.info.size, 1)
+                    || column.bytes != block.row_count * component.info.size) {
+                    return corrupt("raw column size mismatch");
+                }
+            } else if (column.encoding == ColumnEncoding::FIELDS) {
+                if (!component.info.default_construct) {
+                    return corrupt("component is not default constructible");
+                }
+                const auto data = file.subspan(column.offset, column.bytes);
+                std::size_t pos = 0;
+                for (u64 row = 0; row < block.row_count; ++row) {
+                    const auto size = measure_fields(component.fields, data.subspan(pos));
+                    if (!size) {
+                        return corrupt("truncated field record");
+                    }
+                    pos += *size;
+                }
+                if (pos != data.size()) {
+                    return corrupt("trailing bytes in field column");
+                }
+            }
+        }
+    }
+    if (header.loose_entities > header.entity_count || block_rows != header.entity_count - header.loose_entities) {
+        return corrupt("entity count mismatch");
+    }
+    
+    // ---- Commit: nothing below can fail ----
+    world.clear();
+    std::vector<Entity> entities;
+    entities.reserve(header.entity_count);
+    
+    std::vector<ColumnSource> sources;
+    std::vector<u32> type_ids;
+    for (const auto& block : *blocks) {
+        if (block.kind != BlockKind::ARCHETYPE) {
+            continue;
+        }
+        sources.clear();
+        type_ids.clear();
+        for (u32 c = block.first_column; c < block.first_column + block.column_count; ++c) {
+            const auto& column = (*columns)[c];
+            const auto& component = resolved[column.component];
+            if (component.type_id != INVALID_COMPONENT) {
+                sources.push_back({&component, column.encoding, file.subspan(column.offset, column.bytes)});
+                type_ids.push_back(component.type_id);
+            }
+        }
+        
+        const auto spawned = world.spawn_columns(type_ids, static_cast<u32>(block.row_count),
+            [&sources](u32 type_id, void* dst, u32 first, u32 count) {
+                auto it = std::ranges::find(sources, type_id, [](const ColumnSource& s) { return s.component->type_id; });
+                fill_column(*it, static_cast<std::byte*>(dst), first, count);
+            });
+        entities.insert(entities.end(), spawned.begin(), spawned.end());
+    }
+    for (u64 i = 0; i < header.loose_entities; ++i) {
+        entities.push_back(world.create_entity());
+    }
+    
+    for (const auto& block : *blocks) {
+        if (block.kind != BlockKind::SPARSE) {
+            continue;
+        }
+        const auto& column = (*columns)[block.first_column];
+        const auto& component = resolved[column.component];
+        if (component.type_id == INVALID_COMPONENT) {
+            continue;
+        }
+        ColumnSource source{&component, column.encoding, file.subspan(column.offset, column.bytes)};
+        ComponentScratch scratch(component.info);
+        for (u64 row = 0; row < block.row_count; ++row) {
+            u32 owner = 0;
+            std::memcpy(&owner, file.data() + block.entity_table + row * sizeof(u32), sizeof(owner));
+            fill_column(source, scratch.get(), row, 1);
+            world.add_component_by_id(entities[owner], component.type_id, scratch.get());  // Relocates out of scratch
+        }
+    }
+    
+    LOG_INFO("Binary scene loaded successfully ({} entities)", entities.size());
+    return {};
+}
+
+auto convert_scene(
+    const std::filesystem::path& from,
+    const std::filesystem::path& to
+) -> std::expected<void, SerializationError> {
+    const auto source_format = format_of(from);
+    const auto target_format = format_of(to);
+    if (source_format == SceneFormat::UNKNOWN || target_format == SceneFormat::UNKNOWN) {
+        LOG_ERROR("Cannot convert {} -> {}: unknown scene extension", from.string(), to.string());
+        return std::unexpected(SerializationError::UNKNOWN_FILE_FORMAT);
+    }
+    
+    World world;
+    auto loaded = source_format == SceneFormat::YAML ? load_scene(world, from) : load_binary_scene(world, from);
+    if (!loaded) {
+        return loaded;
+    }
+    return target_format == SceneFormat::YAML ? save_scene(world, to) : save_binary_scene(world, to);
+}
+
+} // namespace luma::scene
@@ -0,0 +1,218 @@
+/**
+ * @file command_buffer.cpp
+ * @brief Deferred command buffer implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/command_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace luma::scene {
+
+namespace {
+
+/**
+ * @brief Round offset up to alignment (alignment must be a power of two)
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+constexpr auto align_up(std::size_t offset, std::size_t alignment) -> std::size_t {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+} // anonymous namespace
+
+// ========== CommandBuffer ==========
+
+CommandBuffer::~CommandBuffer() {
+    clear();
+    release_blocks();
+}
+
+auto CommandBuffer::allocate(std::size_t size, std::size_t alignment) -> std::byte* {
+    if (blocks_.empty() || align_up(blocks_.back().used, alignment) + size > blocks_.back().capacity) {
+        const std::size_t capacity = std::max(BLOCK_SIZE, size);
+        blocks_.push_back(Block{
+            .data = static_cast<std::byte*>(::operator new(capacity, std::align_val_t{BLOCK_ALIGNMENT})),
+            .capacity = capacity,
+        });
+    }
+    
+    auto& block = blocks_.back();
+    const std::size_t offset = align_up(block.used, alignment);
+    block.used = offset + size;
+    return block.data + offset;
+}
+
+auto CommandBuffer::release_blocks() -> void {
+    for (const auto& block : blocks_) {
+        ::operator delete(block.data, std::align_val_t{BLOCK_ALIGNMENT});
+    }
+    blocks_.clear();
+}
+
+auto CommandBuffer::clear() -> void {
+    // Destroy components that were recorded but never consumed
+    const auto& registry = ComponentRegistry::instance();
+    for (const auto& command : commands_) {
+        if (command.payload) {
+            registry.info(command.type_id).destroy(command.payload);
+        }
+    }
+    commands_.clear();
+    
+    // Keep one block for the next frame's recording
+    if (blocks_.size() > 1) {
+        for (std::size_t i = 1; i < blocks_.size(); ++i) {
+            ::operator delete(blocks_[i].data, std::align_val_t{BLOCK_ALIGNMENT});
+        }
+        blocks_.resize(1);
+    }
+    if (!blocks_.empty()) {
+        blocks_.front().used = 0;
+    }
+}
+
+auto CommandBuffer::merge(CommandBuffer& other) -> void {
+    // Payload pointers stay valid: blocks move, their memory does not
+    commands_.insert(commands_.end(), other.commands_.begin(), other.commands_.end());
+    
+    // Keep our active block last so later recording continues filling it
+    std::vector<Block> blocks = std::move(other.blocks_);
+    blocks.insert(blocks.end(), blocks_.begin(), blocks_.end());
+    blocks_ = std::move(blocks);
+    
+    other.commands_.clear();
+    other.blocks_.clear();
+}
+
+auto CommandBuffer::apply(World& world) -> void {
+    // Phase 1: operations on existing entities, grouped by current archetype.
+    // Stable sort keeps each entity's operations in recorded order (same key).
+    struct EntityOp {
+        u32 archetype;  ///< Archetype of the target entity when apply() started
+        std::size_t command;  ///< Index into commands_
+    };
+    std::vector<EntityOp> entity_ops;
+    
+    // Phase 2: spawns, grouped by destination archetype
+    struct SpawnOp {
+        u32 archetype;  ///< Destination archetype
+        std::size_t command;  ///< Index of SPAWN header in commands_
+    };
+    std::vector<SpawnOp> spawn_ops;
+    std::vector<u32> type_ids;
+    
+    for (std::size_t i = 0; i < commands_.size(); ++i) {
+        const auto& command = commands_[i];
+        switch (command.kind) {
+            case CommandKind::SPAWN: {
+                type_ids.clear();
+                for (u32 c = 1; c <= command.component_count; ++c) {
+                    type_ids.push_back(commands_[i + c].type_id);
+                }
+                spawn_ops.push_back(SpawnOp{world.archetype_for_ids(type_ids), i});
+                i += command.component_count;
+                break;
+            }
+            case CommandKind::DESTROY:
+            case CommandKind::ADD:
+            case CommandKind::REMOVE:
+                entity_ops.push_back(EntityOp{world.archetype_of(command.entity), i});
+                break;
+            case CommandKind::SPAWN_COMPONENT:
+                break;  // Consumed with its SPAWN header
+        }
+    }
+    
+    std::ranges::stable_sort(entity_ops, {}, &EntityOp::archetype);
+    for (const auto& op : entity_ops) {
+        auto& command = commands_[op.command];
+        switch (command.kind) {
+            case CommandKind::DESTROY:
+                world.destroy_entity(command.entity);
+                break;
+            case CommandKind::ADD:
+                if (world.add_component_by_id(command.entity, command.type_id, command.payload)) {
+                    command.payload = nullptr;  // Relocated into the world
+                }
+                break;
+            case CommandKind::REMOVE:
+                world.remove_component_by_id(command.entity, command.type_id);
+                break;
+            default:
+                break;
+        }
+    }
+    
+    std::ranges::stable_sort(spawn_ops, {}, &SpawnOp::archetype);
+    std::vector<void*> payloads;
+    for (const auto& op : spawn_ops) {
+        const auto& header = commands_[op.command];
+        type_ids.clear();
+        payloads.clear();
+        for (u32 c = 1; c <= header.component_count; ++c) {
+            auto& component = commands_[op.command + c];
+            type_ids.push_back(component.type_id);
+            payloads.push_back(component.payload);
+            component.payload = nullptr;  // Relocated into the world below
+        }
+        world.spawn_by_ids(op.archetype, type_ids, payloads);
+    }
+    
+    clear();
+}
+
+// ========== ThreadCommandBuffers ==========
+
+namespace {
+
+/**
+ * @brief Buffer the calling thread used last, and the instance owning it
+ * 
+ * Keyed by instance number rather than address: a destroyed instance's
+ * number is never handed out again, so a stale entry can never match.
+ */
+struct LocalBufferCache {
+    u64 instance{0};  ///< ThreadCommandBuffers::instance_ (0: empty)
+    CommandBuffer* buffer{nullptr};  ///< That instance's buffer for this thread
+};
+
+std::atomic<u64> next_instance{1};
+thread_local LocalBufferCache local_cache;
+
+} // anonymous namespace
+
+ThreadCommandBuffers::ThreadCommandBuffers()
+    : instance_(next_instance.fetch_add(1, std::memory_order_relaxed)) {}
+
+auto ThreadCommandBuffers::local() -> CommandBuffer& {
+    if (local_cache.instance == instance_) {
+        return *local_cache.buffer;  // Buffers live as long as the instance
+    }
+    
+    std::scoped_lock lock(mutex_);
+    auto& buffer = buffers_[std::this_thread::get_id()];
+    if (!buffer) {
+        buffer = std::make_unique<CommandBuffer>();
+    }
+    local_cache = {.instance = instance_, .buffer = buffer.get()};
+    return *buffer;
+}
+
+auto ThreadCommandBuffers::apply(World& world) -> void {
+    std::scoped_lock lock(mutex_);
+    
+    // Merge into one batch so grouping by archetype spans all threads
+    CommandBuffer batch;
+    for (auto& [thread, buffer] : buffers_) {
+        batch.merge(*buffer);
+    }
+    batch.apply(world);
+}
+
+} // namespace luma::scene
@@ -0,0 +1,265 @@
+/**
+ * @file hierarchy.cpp
+ * @brief Parent/child relationships and world-transform propagation implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/hierarchy.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_set>
+#include <utility>
+
+namespace luma::scene {
+
+namespace {
+
+/**
+ * @brief Levels smaller than this are computed on the calling thread
+ */
+constexpr std::size_t PARALLEL_LEVEL_THRESHOLD = 256;
+
+/**
+ * @brief Check whether an entity takes part in propagation
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto is_node(const World& world, Entity entity) -> bool {
+    return world.has_component<Transform>(entity) && world.has_component<WorldTransform>(entity);
+}
+
+} // anonymous namespace
+
+// ========== Relationships ==========
+
+auto set_parent(World& world, Entity child, Entity parent) -> bool {
+    if (child == parent || !world.is_alive(child) || !world.is_alive(parent)) {
+        return false;
+    }
+    
+    // Refuse cycles: child must not be an ancestor of parent
+    const World& view = world;  // Const lookups do not stamp change ticks
+    for (const Parent* up = view.get_component<Parent>(parent); up; up = view.get_component<Parent>(up->entity)) {
+        if (up->entity == child) {
+            return false;
+        }
+    }
+    
+    remove_parent(world, child);
+    world.add_component(child, Parent{parent});
+    if (auto* children = world.get_component<Children>(parent)) {
+        children->entities.push_back(child);
+    } else {
+        world.add_component(parent, Children{{child}});
+    }
+    
+    if (!world.has_component<WorldTransform>(child)) {
+        world.add_component(child, WorldTransform{});
+    }
+    if (!world.has_component<WorldTransform>(parent)) {
+        world.add_component(parent, WorldTransform{});
+    }
+    return true;
+}
+
+auto remove_parent(World& world, Entity child) -> void {
+    const auto* parent = std::as_const(world).get_component<Parent>(child);
+    if (!parent) {
+        return;
+    }
+    
+    const Entity old_parent = parent->entity;
+    world.remove_component<Parent>(child);
+    if (auto* children = world.get_component<Children>(old_parent)) {
+        std::erase(children->entities, child);  // Mutable access stamps Children: layout rebuilds
+    }
+}
+
+auto destroy_recursive(World& world, Entity entity) -> void {
+    if (!world.is_alive(entity)) {
+        return;
+    }
+    
+    remove_parent(world, entity);
+    
+    std::vector<Entity> pending{entity};
+    while (!pending.empty()) {
+        const Entity current = pending.back();
+        pending.pop_back();
+        if (const auto* children = std::as_const(world).get_component<Children>(current)) {
+            pending.insert(pending.end(), children->entities.begin(), children->entities.end());
+        }
+        world.destroy_entity(current);
+    }
+}
+
+// ========== TransformHierarchy ==========
+
+auto TransformHierarchy::propagate(World& world) -> void {
+    run(world, nullptr);
+}
+
+auto TransformHierarchy::propagate(World& world, JobSystem& jobs) -> void {
+    run(world, &jobs);
+}
+
+auto TransformHierarchy::run(World& world, JobSystem* jobs) -> void {
+    const World& view = world;
+    
+    // Dirty nodes per depth; a stale layout means everything is recomputed
+    std::vector<std::vector<Entity>> dirty;
+    if (!built_ || structure_changed(view) || !collect_dirty(view, dirty)) {
+        build(view);
+        dirty = levels_;
+    }
+    
+    // Workers stamp their own rows: raise the shared per-chunk hints once
+    // here so no two workers write the same tick word
+    const auto parallel = [jobs](const std::vector<Entity>& level) {
+        return jobs && level.size() >= PARALLEL_LEVEL_THRESHOLD;
+    };
+    if (std::ranges::any_of(dirty, parallel)) {
+        world.prepare_concurrent_writes<WorldTransform>();
+    }
+    
+    last_updated_ = 0;
+    
+    // One node: resolve (read-only lookups, plus a row stamp of its own
+    // WorldTransform) and compose with the parent computed one level up
+    const auto update = [&world, &view](Entity entity, bool root) -> bool {
+        const auto* local = view.get_component<Transform>(entity);
+        if (!local || !view.has_component<WorldTransform>(entity)) {
+            return false;  // Destroyed or detached since the layout was built
+        }
+        const WorldTransform* parent_world = nullptr;
+        if (!root) {
+            const auto* parent = view.get_component<Parent>(entity);
+            parent_world = parent ? view.get_component<WorldTransform>(parent->entity) : nullptr;
+        }
+        auto* out = world.get_component<WorldTransform>(entity);
+        out->matrix = parent_world ? parent_world->matrix * local->to_matrix() : local->to_matrix();
+        return true;
+    };
+    
+    for (std::size_t depth = 0; depth < dirty.size(); ++depth) {
+        // Every node of a level depends only on the previous level
+        const auto& level = dirty[depth];
+        const bool root = depth == 0;
+        if (parallel(level)) {
+            const std::size_t batches = std::max<std::size_t>(jobs->thread_count(), 1) * 4;
+            const std::size_t batch_size = (level.size() + batches - 1) / batches;
+            std::atomic<std::size_t> updated{0};
+            jobs->parallel_for(0, (level.size() + batch_size - 1) / batch_size, 1, [&](std::size_t batch) {
+                const std::size_t end = std::min(level.size(), (batch + 1) * batch_size);
+                std::size_t count = 0;
+                for (std::size_t i = batch * batch_size; i < end; ++i) {
+                    count += update(level[i], root) ? 1 : 0;
+                }
+                updated.fetch_add(count, std::memory_order_relaxed);
+            });
+            last_updated_ += updated.load(std::memory_order_relaxed);
+        } else {
+            for (const Entity entity : level) {
+                last_updated_ += update(entity, root) ? 1 : 0;
+            }
+        }
+    }
+    
+    // Our own WorldTransform writes carry last_tick_; anything written after
+    // this point (even later in the same frame) is newer and shows as dirty
+    last_tick_ = world.change_tick();
+    world.advance_tick();
+}
+
+auto TransformHierarchy::build(const World& world) -> void {
+    levels_.clear();
+    depth_.clear();
+    
+    // Level 0: nodes without a parent node
+    std::vector<Entity> roots;
+    world.each<Transform, WorldTransform>([&](Entity entity, const Transform&, const WorldTransform&) {
+        const auto* parent = world.get_component<Parent>(entity);
+        if (!parent || !world.is_alive(parent->entity) || !is_node(world, parent->entity)) {
+            roots.push_back(entity);
+            depth_.emplace(entity, 0);
+        }
+    });
+    if (!roots.empty()) {
+        levels_.push_back(std::move(roots));
+    }
+    
+    // Breadth-first: level k+1 = consistent children of level k
+    for (u32 depth = 0; depth < levels_.size(); ++depth) {
+        std::vector<Entity> next;
+        for (const Entity entity : levels_[depth]) {
+            const auto* children = world.get_component<Children>(entity);
+            if (!children) {
+                continue;
+            }
+            for (const Entity child : children->entities) {
+                const auto* parent = world.get_component<Parent>(child);
+                if (parent && parent->entity == entity && is_node(world, child)
+                    && depth_.emplace(child, depth + 1).second) {
+                    next.push_back(child);
+                }
+            }
+        }
+        if (!next.empty()) {
+            levels_.push_back(std::move(next));
+        }
+    }
+    
+    built_ = true;
+}
+
+auto TransformHierarchy::collect_dirty(const World& world, std::vector<std::vector<Entity>>& dirty) const -> bool {
+    dirty.assign(levels_.size(), {});
+    std::unordered_set<Entity> seen;
+    bool known = true;
+    
+    // Seeds: nodes whose own Transform or WorldTransform was written
+    const auto seed = [&](Entity entity, const auto&) {
+        const auto it = depth_.find(entity);
+        if (it == depth_.end()) {
+            known = known && !is_node(world, entity);  // A new node invalidates the layout
+            return;
+        }
+        if (seen.insert(entity).second) {
+            dirty[it->second].push_back(entity);
+        }
+    };
+    world.each_changed<Transform>(last_tick_, seed);
+    world.each_changed<WorldTransform>(last_tick_, seed);
+    if (!known) {
+        return false;
+    }
+    
+    // Descend from the seeds only: clean subtrees are never visited
+    for (std::size_t depth = 0; depth + 1 < dirty.size(); ++depth) {
+        for (const Entity entity : dirty[depth]) {
+            const auto* children = world.get_component<Children>(entity);
+            if (!children) {
+                continue;
+            }
+            for (const Entity child : children->entities) {
+                const auto it = depth_.find(child);
+                if (it != depth_.end() && it->second == depth + 1 && seen.insert(child).second) {
+                    dirty[depth + 1].push_back(child);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+auto TransformHierarchy::structure_changed(const World& world) const -> bool {
+    bool changed = false;
+    world.each_changed<Parent>(last_tick_, [&](Entity, const Parent&) { changed = true; });
+    world.each_changed<Children>(last_tick_, [&](Entity, const Children&) { changed = true; });
+    return changed;
+}
+
+} // namespace luma::scene
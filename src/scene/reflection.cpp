@@ -0,0 +1,144 @@
+/**
+ * @file reflection.cpp
+ * @brief Generic field operations over reflected components
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/reflection.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace luma::scene {
+
+namespace {
+
+/**
+ * @brief Address of a field inside an object
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto field_ptr(const void* object, const FieldInfo& field) -> const std::byte* {
+    return static_cast<const std::byte*>(object) + field.offset;
+}
+
+auto field_ptr(void* object, const FieldInfo& field) -> std::byte* {
+    return static_cast<std::byte*>(object) + field.offset;
+}
+
+/**
+ * @brief View a string field
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto string_at(const void* object, const FieldInfo& field) -> const std::string& {
+    return *std::launder(reinterpret_cast<const std::string*>(field_ptr(object, field)));
+}
+
+auto string_at(void* object, const FieldInfo& field) -> std::string& {
+    return *std::launder(reinterpret_cast<std::string*>(field_ptr(object, field)));
+}
+
+} // anonymous namespace
+
+auto find_field(std::span<const FieldInfo> fields, std::string_view name) -> const FieldInfo* {
+    const auto it = std::ranges::find(fields, name, &FieldInfo::name);
+    return it != fields.end() ? &*it : nullptr;
+}
+
+auto migrate_fields(
+    std::span<const FieldInfo> to, void* dst,
+    std::span<const FieldInfo> from, const void* src
+) -> std::size_t {
+    std::size_t copied = 0;
+    for (const auto& field : to) {
+        const auto* source = find_field(from, field.name);
+        if (!source || source->type != field.type) {
+            continue;
+        }
+        if (field.type == FieldType::STRING) {
+            string_at(dst, field) = string_at(src, *source);
+        } else {
+            std::memcpy(field_ptr(dst, field), field_ptr(src, *source), field_size(field.type));
+        }
+        ++copied;
+    }
+    return copied;
+}
+
+auto write_fields(std::span<const FieldInfo> fields, const void* object, std::vector<std::byte>& out) -> void {
+    const auto append = [&out](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const std::byte*>(data);
+        out.insert(out.end(), bytes, bytes + size);
+    };
+    
+    for (const auto& field : fields) {
+        if (field.type == FieldType::STRING) {
+            const auto& value = string_at(object, field);
+            const auto length = static_cast<u32>(value.size());
+            append(&length, sizeof(length));
+            append(value.data(), length);
+        } else {
+            append(field_ptr(object, field), field_size(field.type));
+        }
+    }
+}
+
+auto read_fields(std::span<const FieldInfo> fields, void* object, std::span<const std::byte> in)
+    -> std::optional<std::size_t> {
+    std::size_t pos = 0;
+    const auto take = [&](void* data, std::size_t size) {
+        if (in.size() - pos < size) {
+            return false;
+        }
+        std::memcpy(data, in.data() + pos, size);
+        pos += size;
+        return true;
+    };
+    
+    for (const auto& field : fields) {
+        if (field.type == FieldType::STRING) {
+            u32 length = 0;
+            if (!take(&length, sizeof(length)) || in.size() - pos < length) {
+                return std::nullopt;
+            }
+            string_at(object, field).assign(reinterpret_cast<const char*>(in.data() + pos), length);
+            pos += length;
+        } else if (field.type == FieldType::BOOL) {
+            u8 value = 0;  // Any byte reads as a valid bool
+            if (!take(&value, sizeof(value))) {
+                return std::nullopt;
+            }
+            *reinterpret_cast<bool*>(field_ptr(object, field)) = value != 0;
+        } else if (!take(field_ptr(object, field), field_size(field.type))) {
+            return std::nullopt;
+        }
+    }
+    return pos;
+}
+
+auto measure_fields(std::span<const FieldInfo> fields, std::span<const std::byte> in)
+    -> std::optional<std::size_t> {
+    std::size_t pos = 0;
+    for (const auto& field : fields) {
+        std::size_t size = field_size(field.type);
+        if (field.type == FieldType::STRING) {
+            u32 length = 0;
+            if (in.size() - pos < sizeof(length)) {
+                return std::nullopt;
+            }
+            std::memcpy(&length, in.data() + pos, sizeof(length));
+            size = sizeof(length) + length;
+        }
+        if (in.size() - pos < size) {
+            return std::nullopt;
+        }
+        pos += size;
+    }
+    return pos;
+}
+
+} // namespace luma::scene
@@ -0,0 +1,94 @@
+/**
+ * @file registry.cpp
+ * @brief Component registry implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/registry.hpp>
+#include <luma/core/logging.hpp>
+
+#include <cstdlib>
+
+namespace luma::scene {
+
+ComponentRegistry::ComponentRegistry() {
+    // Built-ins occupy their fixed compile-time IDs (appended in ID order)
+    std::scoped_lock lock(mutex_);
+    append({ComponentTypeInfo::of<Transform>(), "Transform", fields_of<Transform>()});
+    append({ComponentTypeInfo::of<Geometry>(), "Geometry", fields_of<Geometry>()});
+    append({ComponentTypeInfo::of<Material>(), "Material", fields_of<Material>()});
+    append({ComponentTypeInfo::of<Velocity>(), "Velocity", fields_of<Velocity>()});
+    append({ComponentTypeInfo::of<Name>(), "Name", fields_of<Name>()});
+}
+
+auto ComponentRegistry::instance() -> ComponentRegistry& {
+    static ComponentRegistry registry;
+    return registry;
+}
+
+auto ComponentRegistry::append(Record record) -> u32 {
+    const u32 type_id = size_.load(std::memory_order_relaxed);
+    const u32 page = type_id / PAGE_SIZE;
+    if (page >= MAX_PAGES) {
+        LOG_FATAL("Component registry full ({} types)", MAX_PAGES * PAGE_SIZE);
+        std::abort();
+    }
+    if (type_id % PAGE_SIZE == 0) {
+        owned_pages_.push_back(std::make_unique<Record[]>(PAGE_SIZE));
+        pages_[page].store(owned_pages_.back().get(), std::memory_order_release);
+    }
+    pages_[page].load(std::memory_order_relaxed)[type_id % PAGE_SIZE] = std::move(record);
+    size_.store(type_id + 1, std::memory_order_release);
+    return type_id;
+}
+
+auto ComponentRegistry::register_type(ComponentTypeInfo info, std::span<const FieldInfo> fields) -> u32 {
+    std::scoped_lock lock(mutex_);
+    return append(Record{.info = info, .name = {}, .fields = fields});
+}
+
+auto ComponentRegistry::set_name(u32 type_id, std::string_view name) -> bool {
+    std::scoped_lock lock(mutex_);
+    const u32 count = size_.load(std::memory_order_relaxed);
+    for (u32 i = 0; i < count; ++i) {
+        if (!name.empty() && i != type_id && record(i).name == name) {
+            LOG_ERROR("Component name '{}' is already registered (type {}), not reusing it for type {}",
+                      name, i, type_id);
+            return false;
+        }
+    }
+    record(type_id).name = name;  // Only ever written under the mutex
+    return true;
+}
+
+auto ComponentRegistry::info(u32 type_id) const -> ComponentTypeInfo {
+    return record(type_id).info;
+}
+
+auto ComponentRegistry::name(u32 type_id) const -> std::string {
+    std::scoped_lock lock(mutex_);
+    return type_id < size_.load(std::memory_order_relaxed) ? record(type_id).name : std::string{};
+}
+
+auto ComponentRegistry::fields(u32 type_id) const -> std::span<const FieldInfo> {
+    return type_id < size_.load(std::memory_order_acquire) ? record(type_id).fields : std::span<const FieldInfo>{};
+}
+
+auto ComponentRegistry::find(std::string_view name) const -> u32 {
+    std::scoped_lock lock(mutex_);
+    const u32 count = size_.load(std::memory_order_relaxed);
+    for (u32 i = 0; i < count; ++i) {
+        if (!record(i).name.empty() && record(i).name == name) {
+            return i;
+        }
+    }
+    return INVALID_COMPONENT;
+}
+
+auto ComponentRegistry::size() const -> u32 {
+    return size_.load(std::memory_order_acquire);
+}
+
+} // namespace luma::scene
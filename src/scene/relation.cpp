@@ -0,0 +1,93 @@
+/**
+ * @file relation.cpp
+ * @brief Relationship pair index implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/relation.hpp>
+
+#include <algorithm>
+
+namespace luma::scene {
+
+auto RelationIndex::add(Entity source, Entity target) -> bool {
+    auto& targets = targets_[source];
+    if (std::ranges::find(targets, target) != targets.end()) {
+        return false;
+    }
+    
+    // Exclusive relation: the new target replaces the old one
+    if (exclusive_ && !targets.empty()) {
+        unlink(sources_, targets.front(), source);
+        targets.clear();
+        --pair_count_;
+    }
+    
+    targets.push_back(target);
+    sources_[target].push_back(source);
+    ++pair_count_;
+    return true;
+}
+
+auto RelationIndex::remove(Entity source, Entity target) -> bool {
+    if (!unlink(targets_, source, target)) {
+        return false;
+    }
+    unlink(sources_, target, source);
+    --pair_count_;
+    return true;
+}
+
+auto RelationIndex::erase_entity(Entity entity) -> void {
+    // As source: drop it from each target's reverse list
+    if (const auto it = targets_.find(entity); it != targets_.end()) {
+        for (const Entity target : it->second) {
+            unlink(sources_, target, entity);
+        }
+        pair_count_ -= it->second.size();
+        targets_.erase(it);
+    }
+    
+    // As target: drop it from each source's target list
+    if (const auto it = sources_.find(entity); it != sources_.end()) {
+        for (const Entity source : it->second) {
+            unlink(targets_, source, entity);
+        }
+        pair_count_ -= it->second.size();
+        sources_.erase(it);
+    }
+}
+
+auto RelationIndex::contains(Entity source, Entity target) const -> bool {
+    const auto targets = this->targets(source);
+    return std::ranges::find(targets, target) != targets.end();
+}
+
+auto RelationIndex::unlink(
+    std::unordered_map<Entity, std::vector<Entity>>& map,
+    Entity key,
+    Entity value
+) -> bool {
+    const auto it = map.find(key);
+    if (it == map.end()) {
+        return false;
+    }
+    
+    auto& list = it->second;
+    const auto found = std::ranges::find(list, value);
+    if (found == list.end()) {
+        return false;
+    }
+    
+    // Swap-pop (lists are unordered)
+    *found = list.back();
+    list.pop_back();
+    if (list.empty()) {
+        map.erase(it);
+    }
+    return true;
+}
+
+} // namespace luma::scene
@@ -0,0 +1,83 @@
+/**
+ * @file scene_components.hpp
+ * @brief Helpers shared by the YAML and binary scene formats (internal)
+ * 
+ * Both formats store the same set of component types (named and
+ * reflected, plus named tags) and decode each value into scratch storage
+ * before relocating it into the world. Not installed; included only by
+ * serialization.cpp and binary_scene.cpp.
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-12
+ */
+
+#pragma once
+
+#include <luma/scene/reflection.hpp>
+#include <luma/scene/registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace luma::scene::detail {
+
+/**
+ * @brief Serializable component type (named and reflected, or a named tag)
+ */
+struct SceneComponent {
+    u32 type_id;  ///< Registry ID
+    std::string name;  ///< Registry name (YAML key / binary component record)
+    std::span<const FieldInfo> fields;  ///< Reflected fields (empty for tags)
+    ComponentTypeInfo info;  ///< Operations table
+};
+
+/**
+ * @brief Collect every registered type the scene formats can write
+ * 
+ * ✨ PURE FUNCTION ✨ (reads the registry)
+ */
+inline auto scene_components() -> std::vector<SceneComponent> {
+    const auto& registry = ComponentRegistry::instance();
+    std::vector<SceneComponent> components;
+    for (u32 type_id = 0; type_id < registry.size(); ++type_id) {
+        auto name = registry.name(type_id);
+        const auto fields = registry.fields(type_id);
+        const auto info = registry.info(type_id);
+        if (!name.empty() && (!fields.empty() || info.storage == StoragePolicy::TAG)) {
+            components.push_back({type_id, std::move(name), fields, info});
+        }
+    }
+    return components;
+}
+
+/**
+ * @brief Aligned scratch storage for one type-erased component
+ * 
+ * ⚠️ IMPURE CLASS (owns raw memory; the component's lifetime is managed
+ * by the caller)
+ */
+class ComponentScratch {
+public:
+    explicit ComponentScratch(const ComponentTypeInfo& info)
+        : alignment_(std::max<std::size_t>(info.alignment, alignof(std::max_align_t)))
+        , data_(::operator new(std::max<std::size_t>(info.size, 1), std::align_val_t{alignment_})) {}
+    
+    ~ComponentScratch() {
+        ::operator delete(data_, std::align_val_t{alignment_});
+    }
+    
+    ComponentScratch(const ComponentScratch&) = delete;
+    ComponentScratch& operator=(const ComponentScratch&) = delete;
+    
+    [[nodiscard]] auto get() const -> std::byte* { return static_cast<std::byte*>(data_); }
+
+private:
+    std::size_t alignment_;  ///< Allocation alignment
+    void* data_;  ///< Uninitialized storage
+};
+
+} // namespace luma::scene::detail
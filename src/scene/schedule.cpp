@@ -0,0 +1,92 @@
+/**
+ * @file schedule.cpp
+ * @brief System schedule implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/schedule.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace luma::scene {
+
+auto Schedule::add_system(std::string name, SystemAccess access, SystemFunction function) -> u32 {
+    systems_.push_back(System{
+        .name = std::move(name),
+        .access = std::move(access),
+        .function = std::move(function),
+        .dependencies = {},
+    });
+    dirty_ = true;
+    return static_cast<u32>(systems_.size() - 1);
+}
+
+auto Schedule::build() -> void {
+    // Edge j -> i for every earlier system j that conflicts with i. A
+    // system's wave is one past the latest wave of its dependencies, so
+    // systems only wait for what they actually conflict with.
+    std::vector<u32> wave_of(systems_.size(), 0);
+    waves_.clear();
+    
+    for (u32 i = 0; i < systems_.size(); ++i) {
+        auto& system = systems_[i];
+        system.dependencies.clear();
+        
+        u32 wave = 0;
+        for (u32 j = 0; j < i; ++j) {
+            if (system.access.conflicts_with(systems_[j].access)) {
+                system.dependencies.push_back(j);
+                wave = std::max(wave, wave_of[j] + 1);
+            }
+        }
+        
+        wave_of[i] = wave;
+        if (wave >= waves_.size()) {
+            waves_.resize(wave + 1);
+        }
+        waves_[wave].push_back(i);
+    }
+    
+    dirty_ = false;
+}
+
+auto Schedule::waves() -> std::span<const std::vector<u32>> {
+    if (dirty_) {
+        build();
+    }
+    return waves_;
+}
+
+auto Schedule::dependencies(u32 system) -> std::span<const u32> {
+    if (dirty_) {
+        build();
+    }
+    return systems_[system].dependencies;
+}
+
+auto Schedule::run(World& world, JobSystem& jobs) -> void {
+    for (const auto& wave : waves()) {
+        if (wave.size() == 1) {
+            systems_[wave.front()].function(world);
+            continue;
+        }
+        
+        // One job per system; parallel_for returns when the wave is done
+        jobs.parallel_for(0, wave.size(), 1, [&](std::size_t i) {
+            systems_[wave[i]].function(world);
+        });
+    }
+}
+
+auto Schedule::run(World& world) -> void {
+    for (const auto& wave : waves()) {
+        for (const auto system : wave) {
+            systems_[system].function(world);
+        }
+    }
+}
+
+} // namespace luma::scene
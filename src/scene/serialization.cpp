@@ -2,7 +2,9 @@
  * @file serialization.cpp
  * @brief Implementation of scene serialization functions
  * 
- * Converts ECS World to/from YAML using yaml-cpp library.
+ * Converts ECS World to/from YAML using yaml-cpp library. Components are
+ * written and read through their reflected field tables (reflection.hpp),
+ * so any named, reflected component type round-trips without code here.
  * 
  * @author LukeFrankio
  * @date 2025-10-12
@@ -10,15 +12,46 @@
 
 #include <luma/scene/serialization.hpp>
 #include <luma/scene/component.hpp>
+#include <luma/scene/reflection.hpp>
+#include <luma/scene/registry.hpp>
 #include <luma/core/logging.hpp>
 
+#include "scene_components.hpp"
+
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
 #include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 namespace luma::scene {
 
 namespace {
 
+using detail::ComponentScratch;
+using detail::SceneComponent;
+using detail::scene_components;
+
 /**
  * @brief Serializes vec3 to YAML sequence
  * 
@@ -46,22 +79,6 @@ auto quat_to_yaml(const glm::quat& q) -> YAML::Node {
     return node;
 }
 
-/**
- * @brief Deserializes vec3 from YAML sequence
- * 
- * ✨ FUNCTIONAL ✨
- */
-auto yaml_to_vec3(const YAML::Node& node) -> std::expected<glm::vec3, SerializationError> {
-    if (!node.IsSequence() || node.size() != 3) {
-        return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
-    }
-    return glm::vec3(
-        node[0].as<float>(),
-        node[1].as<float>(),
-        node[2].as<float>()
-    );
-}
-
 /**
  * @brief Deserializes quat from YAML sequence
  * 
@@ -80,202 +97,451 @@ auto yaml_to_quat(const YAML::Node& node) -> std::expected<glm::quat, Serializat
 }
 
 /**
- * @brief Serializes Transform component
+ * @brief Scene file version written by save_scene()
+ * 
+ * 1: hand-written per-component layouts (Geometry as type + shape keys)
+ * 2: reflected layouts (every component is its field table)
  */
-auto serialize_transform(const Transform& transform) -> YAML::Node {
-    YAML::Node node;
-    node["position"] = vec3_to_yaml(transform.position);
-    node["rotation"] = quat_to_yaml(transform.rotation);
-    node["scale"] = vec3_to_yaml(transform.scale);
-    return node;
+constexpr int SCENE_VERSION = 2;
+
+/**
+ * @brief Below this many entities load_scene_parallel() decodes on the
+ * calling thread (job overhead would dominate)
+ */
+constexpr std::size_t PARALLEL_LOAD_THRESHOLD = 256;
+
+/**
+ * @brief Compare ASCII strings ignoring case
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto iequals(std::string_view a, std::string_view b) -> bool {
+    return std::ranges::equal(a, b, [](char x, char y) {
+        return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+    });
 }
 
 /**
- * @brief Deserializes Transform component
+ * @brief Read a float sequence of fixed length
+ * 
+ * ✨ FUNCTIONAL ✨
  */
-auto deserialize_transform(const YAML::Node& node) -> std::expected<Transform, SerializationError> {
-    if (!node["position"] || !node["rotation"] || !node["scale"]) {
-        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+template<std::size_t N>
+auto yaml_to_floats(const YAML::Node& node) -> std::expected<std::array<float, N>, SerializationError> {
+    if (!node.IsSequence() || node.size() != N) {
+        return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
     }
-    
-    auto pos = yaml_to_vec3(node["position"]);
-    if (!pos) return std::unexpected(pos.error());
-    
-    auto rot = yaml_to_quat(node["rotation"]);
-    if (!rot) return std::unexpected(rot.error());
-    
-    auto scale = yaml_to_vec3(node["scale"]);
-    if (!scale) return std::unexpected(scale.error());
-    
-    return Transform{
-        .position = *pos,
-        .rotation = *rot,
-        .scale = *scale
-    };
+    std::array<float, N> values{};
+    for (std::size_t i = 0; i < N; ++i) {
+        values[i] = node[i].as<float>();
+    }
+    return values;
 }
 
 /**
- * @brief Serializes Geometry component
+ * @brief Serializes one reflected field
+ * 
+ * ✨ PURE FUNCTION ✨
  */
-auto serialize_geometry(const Geometry& geom) -> YAML::Node {
-    YAML::Node node;
+auto field_to_yaml(const FieldInfo& field, const std::byte* object) -> YAML::Node {
+    const std::byte* ptr = object + field.offset;
+    const auto load = [ptr]<typename T>(std::type_identity<T>) {
+        T value;
+        std::memcpy(&value, ptr, sizeof(T));
+        return value;
+    };
     
-    // Serialize type as string
-    switch (geom.type) {
-        case SDFType::SPHERE:
-            node["type"] = "Sphere";
-            node["radius"] = geom.params.x;
-            break;
-        case SDFType::BOX:
-            node["type"] = "Box";
-            node["extents"] = vec3_to_yaml(glm::vec3(geom.params));
-            node["rounding"] = geom.rounding;
-            break;
-        case SDFType::PLANE:
-            node["type"] = "Plane";
-            node["normal"] = vec3_to_yaml(glm::vec3(geom.params));
-            node["distance"] = geom.params.w;
-            break;
-        default:
-            break;
+    switch (field.type) {
+        case FieldType::BOOL:
+            return YAML::Node(load(std::type_identity<u8>{}) != 0);
+        case FieldType::U8: {
+            const u32 value = load(std::type_identity<u8>{});
+            if (value < field.enumerators.size()) {
+                return YAML::Node(std::string(field.enumerators[value]));
+            }
+            return YAML::Node(value);
+        }
+        case FieldType::I32: {
+            const i32 value = load(std::type_identity<i32>{});
+            if (value >= 0 && static_cast<std::size_t>(value) < field.enumerators.size()) {
+                return YAML::Node(std::string(field.enumerators[static_cast<std::size_t>(value)]));
+            }
+            return YAML::Node(value);
+        }
+        case FieldType::U32: {
+            const u32 value = load(std::type_identity<u32>{});
+            if (value < field.enumerators.size()) {
+                return YAML::Node(std::string(field.enumerators[value]));
+            }
+            return YAML::Node(value);
+        }
+        case FieldType::U64:
+            return YAML::Node(load(std::type_identity<u64>{}));
+        case FieldType::F32:
+            return YAML::Node(load(std::type_identity<f32>{}));
+        case FieldType::VEC2: {
+            const auto v = load(std::type_identity<vec2>{});
+            YAML::Node node;
+            node.push_back(v.x);
+            node.push_back(v.y);
+            return node;
+        }
+        case FieldType::VEC3:
+            return vec3_to_yaml(load(std::type_identity<vec3>{}));
+        case FieldType::VEC4: {
+            const auto v = load(std::type_identity<vec4>{});
+            YAML::Node node;
+            node.push_back(v.x);
+            node.push_back(v.y);
+            node.push_back(v.z);
+            node.push_back(v.w);
+            return node;
+        }
+        case FieldType::QUAT:
+            return quat_to_yaml(load(std::type_identity<quat>{}));
+        case FieldType::STRING:
+            return YAML::Node(*std::launder(reinterpret_cast<const std::string*>(ptr)));
     }
-    
-    return node;
+    return {};
 }
 
 /**
- * @brief Deserializes Geometry component
+ * @brief Parse an enum field (enumerator name, case-insensitive, or number)
+ * 
+ * ✨ FUNCTIONAL ✨
+ * 
+ * @tparam Int Integer the number is read as (u32 or i32)
  */
-auto deserialize_geometry(const YAML::Node& node) -> std::expected<Geometry, SerializationError> {
-    if (!node["type"]) {
-        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+template<typename Int>
+auto yaml_to_enum(const FieldInfo& field, const YAML::Node& node) -> std::expected<Int, SerializationError> {
+    const auto text = node.as<std::string>();
+    for (std::size_t i = 0; i < field.enumerators.size(); ++i) {
+        if (iequals(text, field.enumerators[i])) {
+            return static_cast<Int>(i);
+        }
     }
+    return node.as<Int>();  // Throws on unknown names (caught by the caller)
+}
+
+/**
+ * @brief Deserializes one reflected field into an object
+ * 
+ * ⚠️ IMPURE (writes the field)
+ */
+auto yaml_to_field(const FieldInfo& field, const YAML::Node& node, std::byte* object)
+    -> std::expected<void, SerializationError> {
+    std::byte* ptr = object + field.offset;
+    const auto store = [ptr](const auto& value) {
+        std::memcpy(ptr, &value, sizeof(value));
+    };
+    const auto store_floats = [&]<std::size_t N>(std::integral_constant<std::size_t, N>)
+        -> std::expected<void, SerializationError> {
+        auto values = yaml_to_floats<N>(node);
+        if (!values) return std::unexpected(values.error());
+        std::memcpy(ptr, values->data(), sizeof(float) * N);
+        return {};
+    };
     
-    const auto type_str = node["type"].as<std::string>();
-    
-    if (type_str == "Sphere" || type_str == "sphere") {
-        if (!node["radius"]) {
-            return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+    switch (field.type) {
+        case FieldType::BOOL:
+            *reinterpret_cast<bool*>(ptr) = node.as<bool>();
+            return {};
+        case FieldType::U8: {
+            auto value = yaml_to_enum<u32>(field, node);
+            if (!value) return std::unexpected(value.error());
+            if (*value > 0xFF) return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
+            store(static_cast<u8>(*value));
+            return {};
         }
-        return Geometry::sphere(node["radius"].as<float>());
-    }
-    else if (type_str == "Box" || type_str == "box") {
-        if (!node["extents"]) {
-            return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+        case FieldType::I32: {
+            auto value = yaml_to_enum<i32>(field, node);
+            if (!value) return std::unexpected(value.error());
+            store(*value);
+            return {};
         }
-        auto extents = yaml_to_vec3(node["extents"]);
-        if (!extents) return std::unexpected(extents.error());
-        
-        const float rounding = node["rounding"] ? node["rounding"].as<float>() : 0.0f;
-        return Geometry::box(*extents, rounding);
-    }
-    else if (type_str == "Plane" || type_str == "plane") {
-        if (!node["normal"]) {
-            return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+        case FieldType::U32: {
+            auto value = yaml_to_enum<u32>(field, node);
+            if (!value) return std::unexpected(value.error());
+            store(*value);
+            return {};
         }
-        auto normal = yaml_to_vec3(node["normal"]);
-        if (!normal) return std::unexpected(normal.error());
-        
-        const float distance = node["distance"] ? node["distance"].as<float>() : 0.0f;
-        return Geometry::plane(*normal, distance);
+        case FieldType::U64:
+            store(node.as<u64>());
+            return {};
+        case FieldType::F32:
+            store(node.as<f32>());
+            return {};
+        case FieldType::VEC2:
+            return store_floats(std::integral_constant<std::size_t, 2>{});
+        case FieldType::VEC3:
+            return store_floats(std::integral_constant<std::size_t, 3>{});
+        case FieldType::VEC4:
+            return store_floats(std::integral_constant<std::size_t, 4>{});
+        case FieldType::QUAT: {
+            auto q = yaml_to_quat(node);
+            if (!q) return std::unexpected(q.error());
+            store(*q);
+            return {};
+        }
+        case FieldType::STRING:
+            *std::launder(reinterpret_cast<std::string*>(ptr)) = node.as<std::string>();
+            return {};
     }
-    
     return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
 }
 
 /**
- * @brief Serializes Material component
+ * @brief Serializes any reflected component as a map of its fields
+ * 
+ * ✨ PURE FUNCTION ✨
  */
-auto serialize_material(const Material& mat) -> YAML::Node {
-    YAML::Node node;
-    node["base_color"] = vec3_to_yaml(mat.base_color);
-    node["metallic"] = mat.metallic;
-    node["roughness"] = mat.roughness;
-    node["emissive_color"] = vec3_to_yaml(mat.emissive_color);
-    node["ior"] = mat.ior;
+auto serialize_component(std::span<const FieldInfo> fields, const void* object) -> YAML::Node {
+    YAML::Node node(YAML::NodeType::Map);
+    for (const auto& field : fields) {
+        node[std::string(field.name)] = field_to_yaml(field, static_cast<const std::byte*>(object));
+    }
     return node;
 }
 
 /**
- * @brief Deserializes Material component
+ * @brief Deserializes a map of fields into a default-constructed component
+ * 
+ * ⚠️ IMPURE (writes object)
+ * 
+ * Missing fields keep their default value; unknown keys are ignored.
  */
-auto deserialize_material(const YAML::Node& node) -> std::expected<Material, SerializationError> {
-    // Support both "base_color" and "albedo" for compatibility
-    auto base_color_node = node["base_color"] ? node["base_color"] : node["albedo"];
-    if (!base_color_node) {
-        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+auto deserialize_component(std::span<const FieldInfo> fields, const YAML::Node& node, void* object)
+    -> std::expected<void, SerializationError> {
+    if (!node.IsMap() && !node.IsNull()) {
+        return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
     }
+    try {
+        for (const auto& field : fields) {
+            if (const auto value = node[std::string(field.name)]) {
+                auto result = yaml_to_field(field, value, static_cast<std::byte*>(object));
+                if (!result) return result;
+            }
+        }
+    } catch (const YAML::Exception&) {
+        return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
+    }
+    return {};
+}
+
+/**
+ * @brief Rewrite a version-1 component node in the version-2 layout
+ * 
+ * ✨ FUNCTIONAL ✨
+ * 
+ * Version 1 stored Geometry by shape (radius / extents / normal + distance)
+ * and accepted the "albedo" / "emission" aliases for Material; the other
+ * built-ins already match their field tables. Keys the version-1 loader
+ * required are still required: without them the component is rejected
+ * instead of loading with defaults.
+ * 
+ * @return Upgraded node, MISSING_REQUIRED_FIELD, or INVALID_COMPONENT_DATA
+ *         for an unknown Geometry type
+ */
+auto upgrade_v1_component(std::string_view name, const YAML::Node& node)
+    -> std::expected<YAML::Node, SerializationError> {
+    const auto require = [&node](std::initializer_list<const char*> keys) {
+        return std::ranges::all_of(keys, [&node](const char* key) { return static_cast<bool>(node[key]); });
+    };
     
-    auto base_color = yaml_to_vec3(base_color_node);
-    if (!base_color) return std::unexpected(base_color.error());
+    if (name == "Geometry") {
+        if (!require({"type"})) {
+            return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+        }
+        YAML::Node upgraded;
+        const auto type = node["type"].as<std::string>();
+        upgraded["type"] = type;
+        
+        glm::vec4 params(0.0f);
+        if (iequals(type, "Sphere")) {
+            if (!require({"radius"})) {
+                return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+            }
+            params.x = node["radius"].as<float>();
+        } else if (iequals(type, "Box")) {
+            if (!require({"extents"})) {
+                return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+            }
+            const auto extents = yaml_to_floats<3>(node["extents"]);
+            if (!extents) return std::unexpected(extents.error());
+            params = glm::vec4((*extents)[0], (*extents)[1], (*extents)[2], 0.0f);
+        } else if (iequals(type, "Plane")) {
+            if (!require({"normal"})) {
+                return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+            }
+            const auto normal = yaml_to_floats<3>(node["normal"]);
+            if (!normal) return std::unexpected(normal.error());
+            params = glm::vec4((*normal)[0], (*normal)[1], (*normal)[2], 0.0f);
+            params.w = node["distance"] ? node["distance"].as<float>() : 0.0f;
+        } else {
+            return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
+        }
+        upgraded["params"] = std::vector<float>{params.x, params.y, params.z, params.w};
+        if (node["rounding"]) {
+            upgraded["rounding"] = node["rounding"];
+        }
+        return upgraded;
+    }
     
-    auto emissive_color = glm::vec3(0.0f);
-    // Support both "emissive_color" and "emission" for compatibility
-    auto emissive_node = node["emissive_color"] ? node["emissive_color"] : node["emission"];
-    if (emissive_node) {
-        auto emissive_result = yaml_to_vec3(emissive_node);
-        if (!emissive_result) return std::unexpected(emissive_result.error());
-        emissive_color = *emissive_result;
+    if (name == "Material") {
+        if (!require({"base_color"}) && !require({"albedo"})) {
+            return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+        }
+        YAML::Node upgraded = YAML::Clone(node);
+        if (!node["base_color"]) {
+            upgraded["base_color"] = node["albedo"];
+        }
+        if (!node["emissive_color"] && node["emission"]) {
+            upgraded["emissive_color"] = node["emission"];
+        }
+        if (!node["ior"]) {
+            upgraded["ior"] = 1.45f;  // Version-1 default
+        }
+        return upgraded;
     }
     
-    return Material{
-        .base_color = *base_color,
-        .metallic = node["metallic"] ? node["metallic"].as<float>() : 0.0f,
-        .roughness = node["roughness"] ? node["roughness"].as<float>() : 0.5f,
-        .emissive_color = emissive_color,
-        .ior = node["ior"] ? node["ior"].as<float>() : 1.45f
-    };
+    const bool complete = name == "Transform" ? require({"position", "rotation", "scale"})
+                        : name == "Velocity"  ? require({"linear"})
+                        : name == "Name"      ? require({"value"})
+                                              : true;
+    if (!complete) {
+        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+    }
+    return node;
 }
 
 /**
- * @brief Serializes Velocity component
+ * @brief Loadable component types by registry name
+ * 
+ * A snapshot of the registry taken once per load, so decoding (possibly on
+ * several threads at once) never takes the registry lock.
  */
-auto serialize_velocity(const Velocity& vel) -> YAML::Node {
-    YAML::Node node;
-    node["linear"] = vec3_to_yaml(vel.linear);
-    return node;
+using ComponentsByName = std::unordered_map<std::string, SceneComponent>;
+
+auto components_by_name() -> ComponentsByName {
+    ComponentsByName components;
+    for (auto& component : scene_components()) {
+        if (component.info.default_construct) {
+            auto name = component.name;
+            components.emplace(std::move(name), std::move(component));
+        }
+    }
+    return components;
 }
 
 /**
- * @brief Deserializes Velocity component
+ * @brief Decode every component of one entity map
+ * 
+ * ⚠️ IMPURE (calls emit)
+ * 
+ * Unknown or malformed components are skipped with a warning. Touches only
+ * `entity_node` and the (read-only) component table, so distinct entities
+ * can be decoded concurrently.
+ * 
+ * @param components Loadable component types
+ * @param entity_node Element of the `entities` sequence (a map)
+ * @param version Scene file version
+ * @param label Entity number used in warnings
+ * @param emit Called as emit(component, object) with a constructed
+ *             component in scratch storage; must relocate it out
  */
-auto deserialize_velocity(const YAML::Node& node) -> std::expected<Velocity, SerializationError> {
-    if (!node["linear"]) {
-        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+template<typename Emit>
+auto decode_components(
+    const ComponentsByName& components,
+    const YAML::Node& entity_node,
+    int version,
+    std::size_t label,
+    Emit&& emit
+) -> void {
+    for (const auto& entry : entity_node) {
+        std::string name;
+        try {
+            name = entry.first.as<std::string>();
+            if (name == "id" || name == "replace" || name == "remove") {
+                continue;  // Handles are reassigned on load; the rest are journal keys
+            }
+            
+            const auto it = components.find(name);
+            if (it == components.end()) {
+                LOG_WARN("Unknown or unreflected component '{}' on entity {}, skipping", name, label);
+                continue;
+            }
+            const auto& component = it->second;
+            
+            const auto node = version == 1 ? upgrade_v1_component(name, entry.second)
+                                           : std::expected<YAML::Node, SerializationError>(entry.second);
+            if (!node) {
+                LOG_WARN("Failed to deserialize {} for entity {}: {}", name, label, error_to_string(node.error()));
+                continue;
+            }
+            ComponentScratch scratch(component.info);
+            component.info.default_construct(scratch.get());
+            if (auto result = deserialize_component(component.fields, *node, scratch.get()); !result) {
+                LOG_WARN("Failed to deserialize {} for entity {}: {}", name, label, error_to_string(result.error()));
+                component.info.destroy(scratch.get());
+                continue;
+            }
+            emit(component, scratch.get());
+        } catch (const YAML::Exception&) {
+            LOG_WARN("Malformed component '{}' on entity {}, skipping", name, label);
+        }
     }
-    
-    auto linear = yaml_to_vec3(node["linear"]);
-    if (!linear) return std::unexpected(linear.error());
-    
-    return Velocity{.linear = *linear};
 }
 
 /**
- * @brief Serializes Name component
+ * @brief Create one entity from its YAML map
+ * 
+ * ⚠️ IMPURE (modifies world)
+ * 
+ * @param world World to add the entity to
+ * @param components Loadable component types
+ * @param entity_node Element of the `entities` sequence
+ * @param version Scene file version
+ * @return New entity, or std::nullopt if the element is not a map
  */
-auto serialize_name(const Name& name) -> YAML::Node {
-    YAML::Node node;
-    node["value"] = name.value;
-    return node;
+auto load_entity(World& world, const ComponentsByName& components, const YAML::Node& entity_node, int version)
+    -> std::optional<Entity> {
+    if (!entity_node.IsMap()) {
+        LOG_WARN("Entity entry is not a map, skipping");
+        return std::nullopt;
+    }
+    const auto entity = world.create_entity();
+    decode_components(components, entity_node, version, entity.id(), [&](const SceneComponent& component, void* object) {
+        world.add_component_by_id(entity, component.type_id, object);  // Relocates out of scratch
+    });
+    return entity;
 }
 
 /**
- * @brief Deserializes Name component
+ * @brief Write one component of an entity as a `Name: {fields}` map entry
+ * 
+ * ⚠️ IMPURE (writes to emitter)
  */
-auto deserialize_name(const YAML::Node& node) -> std::expected<Name, SerializationError> {
-    if (!node["value"]) {
-        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
-    }
-    
-    return Name{.value = node["value"].as<std::string>()};
+auto emit_component(YAML::Emitter& out, const World& world, Entity entity, const SceneComponent& component) -> void {
+    const void* data = world.get_component_by_id(entity, component.type_id);
+    out << YAML::Key << component.name << YAML::Value
+        << (data ? serialize_component(component.fields, data) : YAML::Node(YAML::NodeType::Map));
 }
 
-}  // anonymous namespace
+/**
+ * @brief Scene file entity ID -> loaded entity
+ */
+using EntityIdMap = std::unordered_map<u64, Entity>;
 
-auto save_scene(
-    const World& world, 
-    const std::filesystem::path& path
-) -> std::expected<void, SerializationError> {
+/**
+ * @brief Write a full scene file
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * @param journal_epoch Written as `journal:` when the file is the base of a
+ *                      SceneJournal (deltas name the base they apply to)
+ */
+auto write_scene(const World& world, const std::filesystem::path& path, std::optional<u64> journal_epoch)
+    -> std::expected<void, SerializationError> {
     LOG_INFO("Saving scene to: {}", path.string());
     
     // Create parent directories if needed
@@ -288,38 +554,36 @@ auto save_scene(
         }
     }
     
+    const auto components = scene_components();
+    
     YAML::Emitter out;
     out << YAML::BeginMap;
-    out << YAML::Key << "version" << YAML::Value << 1;
+    out << YAML::Key << "version" << YAML::Value << SCENE_VERSION;
+    if (journal_epoch) {
+        out << YAML::Key << "journal" << YAML::Value << *journal_epoch;
+    }
     out << YAML::Key << "entities" << YAML::Value << YAML::BeginSeq;
     
-    // Serialize all entities with all components
-    world.each<Transform>([&](Entity entity, const Transform& transform) {
-        out << YAML::BeginMap;
-        out << YAML::Key << "id" << YAML::Value << entity.id();
-        
-        // Always serialize Transform (we're in Transform query)
-        out << YAML::Key << "Transform" << YAML::Value << serialize_transform(transform);
-        
-        // Check for other components and serialize them
-        if (const auto* geom = world.get_component<Geometry>(entity)) {
-            out << YAML::Key << "Geometry" << YAML::Value << serialize_geometry(*geom);
-        }
-        
-        if (const auto* mat = world.get_component<Material>(entity)) {
-            out << YAML::Key << "Material" << YAML::Value << serialize_material(*mat);
-        }
-        
-        if (const auto* vel = world.get_component<Velocity>(entity)) {
-            out << YAML::Key << "Velocity" << YAML::Value << serialize_velocity(*vel);
+    // Every entity with at least one serializable component, in ID order
+    std::size_t saved_count = 0;
+    for (const Entity entity : world.entities()) {
+        bool open = false;
+        for (const auto& component : components) {
+            if (!world.has_component_by_id(entity, component.type_id)) {
+                continue;
+            }
+            if (!open) {
+                out << YAML::BeginMap;
+                out << YAML::Key << "id" << YAML::Value << entity.id();
+                open = true;
+            }
+            emit_component(out, world, entity, component);
         }
-        
-        if (const auto* name = world.get_component<Name>(entity)) {
-            out << YAML::Key << "Name" << YAML::Value << serialize_name(*name);
+        if (open) {
+            out << YAML::EndMap;
+            ++saved_count;
         }
-        
-        out << YAML::EndMap;
-    });
+    }
     
     out << YAML::EndSeq;
     out << YAML::EndMap;
@@ -332,14 +596,28 @@ auto save_scene(
     }
     
     file << out.c_str();
-    LOG_INFO("Scene saved successfully ({} entities)", world.entity_count());
+    if (!file.good()) {
+        LOG_ERROR("Failed to write scene: {}", path.string());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    LOG_INFO("Scene saved successfully ({} entities)", saved_count);
     
     return {};
 }
 
-auto load_scene(
-    World& world, 
-    const std::filesystem::path& path
+/**
+ * @brief Read a full scene file into a (cleared) world
+ * 
+ * ✨ FUNCTIONAL (but has I/O side effects) ✨
+ * 
+ * @param ids If set, receives file entity ID -> created entity
+ * @param journal_epoch If set, receives the file's `journal:` epoch
+ */
+auto read_scene(
+    World& world,
+    const std::filesystem::path& path,
+    EntityIdMap* ids,
+    std::optional<u64>* journal_epoch
 ) -> std::expected<void, SerializationError> {
     LOG_INFO("Loading scene from: {}", path.string());
     
@@ -365,7 +643,7 @@ auto load_scene(
     }
     
     const int version = root["version"].as<int>();
-    if (version != 1) {
+    if (version < 1 || version > SCENE_VERSION) {
         LOG_ERROR("Unsupported scene version: {}", version);
         return std::unexpected(SerializationError::UNSUPPORTED_VERSION);
     }
@@ -379,67 +657,965 @@ auto load_scene(
         return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
     }
     
+    const auto components = components_by_name();
     std::size_t loaded_count = 0;
     for (const auto& entity_node : root["entities"]) {
-        // Create entity
-        const auto entity = world.create_entity();
-        
-        // Load Transform (required)
-        if (!entity_node["Transform"]) {
-            LOG_WARN("Entity missing Transform component, skipping");
-            world.destroy_entity(entity);
+        const auto entity = load_entity(world, components, entity_node, version);
+        if (!entity) {
             continue;
         }
-        
-        auto transform = deserialize_transform(entity_node["Transform"]);
-        if (!transform) {
-            LOG_ERROR("Failed to deserialize Transform: {}", static_cast<int>(transform.error()));
-            world.destroy_entity(entity);
+        ++loaded_count;
+        if (ids && entity_node["id"]) {
+            try {
+                ids->insert_or_assign(entity_node["id"].as<u64>(), *entity);
+            } catch (const YAML::Exception&) {
+                LOG_WARN("Entity {} has a malformed id", entity->id());
+            }
+        }
+    }
+    
+    if (journal_epoch && root["journal"]) {
+        try {
+            *journal_epoch = root["journal"].as<u64>();
+        } catch (const YAML::Exception&) {
+            LOG_WARN("Malformed journal epoch in {}, ignoring its journal", path.string());
+        }
+    }
+    
+    LOG_INFO("Scene loaded successfully ({} entities)", loaded_count);
+    return {};
+}
+
+/**
+ * @brief Shared state between a SceneStreamLoader and its parser thread
+ * 
+ * ⚠️ IMPURE CLASS (guarded by mutex)
+ */
+struct SceneStreamState {
+    std::mutex mutex;  ///< Guards everything below
+    std::condition_variable changed;  ///< Signalled on every push, pop and finish
+    std::deque<YAML::Node> pending;  ///< Parsed, not yet loaded entity nodes
+    std::size_t max_pending{0};  ///< Parser blocks while pending is this full
+    std::optional<std::string> version;  ///< Raw `version` scalar once parsed
+    std::optional<SerializationError> error;  ///< Parser-side failure
+    bool finished{false};  ///< Parser thread is done (check error)
+    bool cancelled{false};  ///< Loader destroyed: parser must stop
+};
+
+/**
+ * @brief Thrown inside the parser thread to abandon a cancelled parse
+ */
+struct StreamCancelled {};
+
+/**
+ * @brief yaml-cpp event handler that cuts `entities:` into per-entity nodes
+ * 
+ * ⚠️ IMPURE CLASS (pushes into SceneStreamState)
+ * 
+ * Only the entity being parsed is ever materialized as a YAML::Node; other
+ * top-level values except `version` are skipped event by event.
+ */
+class EntityStreamHandler final : public YAML::EventHandler {
+public:
+    explicit EntityStreamHandler(SceneStreamState& state) : state_(state) {}
+    
+    [[nodiscard]] auto saw_entities() const -> bool { return saw_entities_; }
+    [[nodiscard]] auto entities_invalid() const -> bool { return entities_invalid_; }
+    
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+    
+    void OnNull(const YAML::Mark&, YAML::anchor_t) override {
+        on_scalar(YAML::Node(YAML::NodeType::Null), {});
+    }
+    
+    void OnAlias(const YAML::Mark&, YAML::anchor_t) override {
+        LOG_WARN("YAML aliases are not supported by the streaming loader, reading as null");
+        on_scalar(YAML::Node(YAML::NodeType::Null), {});
+    }
+    
+    void OnScalar(const YAML::Mark&, const std::string&, YAML::anchor_t, const std::string& value) override {
+        on_scalar(YAML::Node(value), value);
+    }
+    
+    void OnSequenceStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override {
+        on_collection_start(YAML::NodeType::Sequence);
+    }
+    
+    void OnSequenceEnd() override { on_collection_end(); }
+    
+    void OnMapStart(const YAML::Mark&, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override {
+        on_collection_start(YAML::NodeType::Map);
+    }
+    
+    void OnMapEnd() override { on_collection_end(); }
+
+private:
+    /**
+     * @brief Collection being built inside the current entity
+     */
+    struct Frame {
+        YAML::Node node;  ///< Sequence or map
+        YAML::Node key;  ///< Map: key waiting for its value
+        bool has_key{false};  ///< Map: key is set
+    };
+    
+    auto on_scalar(YAML::Node node, const std::string& text) -> void {
+        if (skip_depth_ > 0) {
+            return;
+        }
+        if (in_entities_) {
+            add_value(std::move(node));
+        } else if (in_root_) {
+            if (!root_key_) {
+                root_key_ = text;
+            } else {
+                if (*root_key_ == "version") {
+                    std::scoped_lock lock(state_.mutex);
+                    state_.version = text;
+                    state_.changed.notify_all();  // Entities parsed ahead of it can be loaded now
+                }
+                root_key_.reset();
+            }
+        }
+    }
+    
+    auto on_collection_start(YAML::NodeType::value type) -> void {
+        if (skip_depth_ > 0) {
+            ++skip_depth_;
+        } else if (in_entities_) {
+            frames_.push_back(Frame{.node = YAML::Node(type), .key = {}, .has_key = false});
+        } else if (!in_root_ && !root_done_ && type == YAML::NodeType::Map) {
+            in_root_ = true;
+        } else if (in_root_ && root_key_ == "entities") {
+            saw_entities_ = true;
+            in_entities_ = type == YAML::NodeType::Sequence;
+            entities_invalid_ = !in_entities_;
+            skip_depth_ = in_entities_ ? 0 : 1;
+            root_key_.reset();
+        } else {
+            skip_depth_ = 1;  // Value of another top-level key (or a non-map document)
+            root_key_.reset();
+        }
+    }
+    
+    auto on_collection_end() -> void {
+        if (skip_depth_ > 0) {
+            --skip_depth_;
+        } else if (in_entities_ && !frames_.empty()) {
+            Frame frame = std::move(frames_.back());
+            frames_.pop_back();
+            add_value(std::move(frame.node));
+        } else if (in_entities_) {
+            in_entities_ = false;  // End of the entities sequence
+        } else if (in_root_) {
+            in_root_ = false;
+            root_done_ = true;
+        }
+    }
+    
+    /**
+     * @brief Attach a finished value to its parent, or emit a whole entity
+     */
+    auto add_value(YAML::Node value) -> void {
+        if (frames_.empty()) {
+            emit(std::move(value));
+            return;
+        }
+        Frame& top = frames_.back();
+        if (top.node.IsSequence()) {
+            top.node.push_back(value);
+        } else if (!top.has_key) {
+            top.key.reset(value);  // Node::operator= would overwrite the previous key in place
+            top.has_key = true;
+        } else {
+            top.node[top.key] = value;
+            top.has_key = false;
+        }
+    }
+    
+    /**
+     * @brief Hand an entity node to the loader (blocks while the queue is full)
+     * 
+     * Until `version` has been seen the loader cannot take anything, so
+     * entities ahead of it are buffered without limit instead of blocking.
+     */
+    auto emit(YAML::Node entity) -> void {
+        std::unique_lock lock(state_.mutex);
+        state_.changed.wait(lock, [&] {
+            return state_.cancelled || state_.pending.size() < state_.max_pending || !state_.version;
+        });
+        if (state_.cancelled) {
+            throw StreamCancelled{};
+        }
+        state_.pending.push_back(std::move(entity));
+        state_.changed.notify_all();
+    }
+    
+    SceneStreamState& state_;  ///< Shared with the loader
+    std::vector<Frame> frames_;  ///< Open collections of the current entity
+    std::optional<std::string> root_key_;  ///< Top-level key awaiting its value
+    int skip_depth_{0};  ///< Nesting depth of a value being skipped
+    bool in_root_{false};  ///< Inside the top-level map
+    bool root_done_{false};  ///< Top-level map closed
+    bool in_entities_{false};  ///< Inside the entities sequence
+    bool saw_entities_{false};  ///< `entities` key was present
+    bool entities_invalid_{false};  ///< `entities` was not a sequence
+};
+
+/**
+ * @brief Body of the parser thread
+ * 
+ * ⚠️ IMPURE (file I/O, publishes into state)
+ */
+auto run_scene_parser(SceneStreamState& state, const std::filesystem::path& path) -> void {
+    std::optional<SerializationError> error;
+    try {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            error = SerializationError::FILE_OPEN_FAILED;
+        } else {
+            YAML::Parser parser(file);
+            EntityStreamHandler handler(state);
+            parser.HandleNextDocument(handler);
+            if (!handler.saw_entities() || handler.entities_invalid()) {
+                LOG_ERROR("Missing or invalid entities array");
+                error = SerializationError::INVALID_COMPONENT_DATA;
+            }
+        }
+    } catch (const StreamCancelled&) {
+        // Loader went away; nothing to report
+    } catch (const YAML::Exception& e) {
+        LOG_ERROR("YAML parse error: {}", e.what());
+        error = SerializationError::YAML_PARSE_ERROR;
+    }
+    
+    std::scoped_lock lock(state.mutex);
+    state.error = error;
+    state.finished = true;
+    state.changed.notify_all();
+}
+
+/**
+ * @brief Validate the raw `version` scalar of a scene
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto parse_scene_version(const std::optional<std::string>& text) -> std::expected<int, SerializationError> {
+    if (!text) {
+        LOG_ERROR("Missing version field in scene file");
+        return std::unexpected(SerializationError::MISSING_REQUIRED_FIELD);
+    }
+    int version = 0;
+    const auto [end, ec] = std::from_chars(text->data(), text->data() + text->size(), version);
+    if (ec != std::errc{} || end != text->data() + text->size() || version < 1 || version > SCENE_VERSION) {
+        LOG_ERROR("Unsupported scene version: {}", *text);
+        return std::unexpected(SerializationError::UNSUPPORTED_VERSION);
+    }
+    return version;
+}
+
+/**
+ * @brief Bump allocator for components decoded ahead of their entity
+ * 
+ * ⚠️ IMPURE CLASS (owns raw memory; object lifetimes are managed by the
+ * caller)
+ */
+class StagingArena {
+public:
+    StagingArena() = default;
+    
+    ~StagingArena() {
+        for (const auto& block : blocks_) {
+            ::operator delete(block.data, std::align_val_t{block.alignment});
+        }
+    }
+    
+    StagingArena(const StagingArena&) = delete;
+    StagingArena& operator=(const StagingArena&) = delete;
+    
+    /**
+     * @brief Uninitialized storage for one object
+     */
+    auto allocate(std::size_t size, std::size_t alignment) -> std::byte* {
+        alignment = std::max<std::size_t>(alignment, 1);
+        if (alignment > BLOCK_ALIGNMENT || size > BLOCK_SIZE / 4) {
+            return add_block(std::max<std::size_t>(size, 1), std::max(alignment, BLOCK_ALIGNMENT));  // Oversized: own block
+        }
+        used_ = (used_ + alignment - 1) / alignment * alignment;
+        if (!current_ || used_ + size > BLOCK_SIZE) {
+            current_ = add_block(BLOCK_SIZE, BLOCK_ALIGNMENT);
+            used_ = 0;
+        }
+        std::byte* object = current_ + used_;
+        used_ += size;
+        return object;
+    }
+
+private:
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+    static constexpr std::size_t BLOCK_ALIGNMENT = 64;
+    
+    struct Block {
+        void* data;  ///< Allocation
+        std::size_t alignment;  ///< Alignment it was allocated with
+    };
+    
+    auto add_block(std::size_t size, std::size_t alignment) -> std::byte* {
+        void* data = ::operator new(size, std::align_val_t{alignment});
+        blocks_.push_back(Block{.data = data, .alignment = alignment});
+        return static_cast<std::byte*>(data);
+    }
+    
+    std::vector<Block> blocks_;  ///< Every allocation (freed together)
+    std::byte* current_{nullptr};  ///< Block being bumped
+    std::size_t used_{0};  ///< Bytes used in current_
+};
+
+/**
+ * @brief Decoded component waiting to be moved into the world
+ */
+struct StagedComponent {
+    const SceneComponent* component;  ///< Type
+    std::byte* object;  ///< Constructed value in the arena (nullptr for tags)
+};
+
+/**
+ * @brief Decoded entity: StagedRange::components[first, first + count)
+ * sorted by type ID
+ */
+struct StagedEntity {
+    u32 first;  ///< First component
+    u32 count;  ///< Component count
+};
+
+/**
+ * @brief Output of one decode job (a contiguous range of the entity list)
+ */
+struct StagedRange {
+    StagingArena arena;  ///< Component storage
+    std::vector<StagedComponent> components;  ///< All entities' components
+    std::vector<StagedEntity> entities;  ///< In file order
+};
+
+/**
+ * @brief Decode entity nodes [begin, end) into a staging range
+ * 
+ * ⚠️ IMPURE (writes range only; safe to run concurrently on distinct ranges)
+ */
+auto stage_entities(
+    const ComponentsByName& components,
+    std::span<const YAML::Node> nodes,
+    std::size_t begin,
+    std::size_t end,
+    int version,
+    StagedRange& range
+) -> void {
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!nodes[i].IsMap()) {
+            LOG_WARN("Entity entry is not a map, skipping");
             continue;
         }
-        world.add_component(entity, *transform);
+        const auto first = static_cast<u32>(range.components.size());
+        decode_components(components, nodes[i], version, i, [&](const SceneComponent& component, void* object) {
+            const auto& info = component.info;
+            const auto duplicate = std::find_if(range.components.begin() + first, range.components.end(),
+                [&](const StagedComponent& staged) { return staged.component == &component; });
+            if (info.storage == StoragePolicy::TAG) {
+                info.destroy(object);
+                if (duplicate == range.components.end()) {
+                    range.components.push_back({&component, nullptr});
+                }
+                return;
+            }
+            if (duplicate != range.components.end()) {
+                info.destroy(duplicate->object);  // Last occurrence wins, as with add_component
+                info.relocate_to(duplicate->object, object);
+                return;
+            }
+            std::byte* slot = range.arena.allocate(info.size, info.alignment);
+            info.relocate_to(slot, object);
+            range.components.push_back({&component, slot});
+        });
+        std::sort(range.components.begin() + first, range.components.end(),
+                  [](const StagedComponent& a, const StagedComponent& b) {
+                      return a.component->type_id < b.component->type_id;
+                  });
+        range.entities.push_back({first, static_cast<u32>(range.components.size()) - first});
+    }
+}
+
+/**
+ * @brief Move staged entities into the world, one spawn_columns() call per
+ * run of consecutive entities with the same archetype
+ * 
+ * ⚠️ IMPURE (modifies world)
+ * 
+ * @return Number of entities created
+ */
+auto commit_staged(World& world, std::span<StagedRange> ranges) -> std::size_t {
+    struct RunEntry {
+        StagedRange* range;
+        const StagedEntity* entity;
+    };
+    const auto staged_of = [](const RunEntry& entry) {
+        return std::span<StagedComponent>(entry.range->components).subspan(entry.entity->first, entry.entity->count);
+    };
+    const auto archetype_types = [&](const RunEntry& entry, std::vector<u32>& types) {
+        types.clear();
+        for (const auto& staged : staged_of(entry)) {
+            if (staged.component->info.storage != StoragePolicy::SPARSE) {
+                types.push_back(staged.component->type_id);
+            }
+        }
+    };
+    
+    std::vector<RunEntry> run;
+    std::vector<u32> run_types;
+    std::vector<u32> types;
+    std::size_t created = 0;
+    const auto flush = [&] {
+        if (run.empty()) {
+            return;
+        }
+        const auto entities = world.spawn_columns(run_types, static_cast<u32>(run.size()),
+            [&](u32 type_id, void* dst, u32 first, u32 count) {
+                for (u32 i = 0; i < count; ++i) {
+                    for (const auto& staged : staged_of(run[first + i])) {
+                        if (staged.component->type_id == type_id) {
+                            const auto& info = staged.component->info;
+                            info.relocate_to(static_cast<std::byte*>(dst) + std::size_t{i} * info.size, staged.object);
+                            break;
+                        }
+                    }
+                }
+            });
+        for (std::size_t i = 0; i < run.size(); ++i) {
+            for (const auto& staged : staged_of(run[i])) {
+                if (staged.component->info.storage == StoragePolicy::SPARSE) {
+                    world.add_component_by_id(entities[i], staged.component->type_id, staged.object);
+                }
+            }
+        }
+        created += run.size();
+        run.clear();
+    };
+    
+    for (auto& range : ranges) {
+        for (const auto& entity : range.entities) {
+            const RunEntry entry{&range, &entity};
+            archetype_types(entry, types);
+            if (!run.empty() && types != run_types) {
+                flush();
+            }
+            if (run.empty()) {
+                run_types = types;
+            }
+            run.push_back(entry);
+        }
+    }
+    flush();
+    return created;
+}
+
+/**
+ * @brief Suffix of the journal file next to a scene file
+ */
+constexpr std::string_view JOURNAL_SUFFIX = ".journal";
+
+/**
+ * @brief Split a journal into its `---`-separated delta documents
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * The emitter never writes a bare `---` line inside a document (such
+ * scalars are quoted), so a line match is a safe separator.
+ */
+auto split_journal(std::string_view text) -> std::vector<std::string_view> {
+    std::vector<std::string_view> documents;
+    std::size_t start = 0;
+    std::size_t pos = 0;
+    while (pos <= text.size()) {
+        const auto end = std::min(text.find('\n', pos), text.size());
+        const auto line = text.substr(pos, end - pos);
+        if (line == "---" || end == text.size()) {
+            const auto document = text.substr(start, (line == "---" ? pos : text.size()) - start);
+            if (document.find_first_not_of(" \t\r\n") != std::string_view::npos) {
+                documents.push_back(document);
+            }
+            start = end + 1;
+        }
+        pos = end + 1;
+    }
+    return documents;
+}
+
+/**
+ * @brief Apply one journal delta to a world loaded from its base scene
+ * 
+ * ⚠️ IMPURE (modifies world and ids)
+ */
+auto apply_delta(World& world, const ComponentsByName& components, const YAML::Node& delta, EntityIdMap& ids)
+    -> void {
+    const int version = delta["version"] ? delta["version"].as<int>() : SCENE_VERSION;
+    
+    // Removals first: a replaced entity may reuse a removed ID
+    if (const auto removed = delta["removed"]; removed && removed.IsSequence()) {
+        for (const auto& id : removed) {
+            if (const auto it = ids.find(id.as<u64>()); it != ids.end()) {
+                world.destroy_entity(it->second);
+                ids.erase(it);
+            }
+        }
+    }
+    
+    const auto entities = delta["entities"];
+    if (!entities || !entities.IsSequence()) {
+        return;
+    }
+    const auto& registry = ComponentRegistry::instance();
+    for (const auto& record : entities) {
+        if (!record.IsMap() || !record["id"]) {
+            LOG_WARN("Journal entity without id, skipping");
+            continue;
+        }
+        const auto id = record["id"].as<u64>();
+        const bool replace = record["replace"] && record["replace"].as<bool>();
         
-        // Load optional components
-        if (entity_node["Geometry"]) {
-            auto geom = deserialize_geometry(entity_node["Geometry"]);
-            if (geom) {
-                world.add_component(entity, *geom);
-            } else {
-                LOG_WARN("Failed to deserialize Geometry for entity {}", entity.id());
+        auto it = ids.find(id);
+        if (replace && it != ids.end()) {
+            world.destroy_entity(it->second);
+            ids.erase(it);
+            it = ids.end();
+        }
+        if (it == ids.end()) {
+            if (!replace) {
+                LOG_WARN("Journal updates unknown entity {}, creating it", id);
             }
+            it = ids.emplace(id, world.create_entity()).first;
         }
+        const Entity entity = it->second;
         
-        if (entity_node["Material"]) {
-            auto mat = deserialize_material(entity_node["Material"]);
-            if (mat) {
-                world.add_component(entity, *mat);
-            } else {
-                LOG_WARN("Failed to deserialize Material for entity {}", entity.id());
+        if (const auto remove = record["remove"]; remove && remove.IsSequence()) {
+            for (const auto& name : remove) {
+                if (const u32 type_id = registry.find(name.as<std::string>()); type_id != INVALID_COMPONENT) {
+                    world.remove_component_by_id(entity, type_id);
+                }
             }
         }
+        decode_components(components, record, version, id, [&](const SceneComponent& component, void* object) {
+            world.add_component_by_id(entity, component.type_id, object);  // Relocates out of scratch
+        });
+    }
+}
+
+}  // anonymous namespace
+
+auto save_scene(
+    const World& world, 
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError> {
+    return write_scene(world, path, std::nullopt);
+}
+
+auto load_scene(
+    World& world, 
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError> {
+    return read_scene(world, path, nullptr, nullptr);
+}
+
+// ========== Streaming Loader ==========
+
+struct SceneStreamLoader::Impl {
+    SceneStreamState state;  ///< Shared with the parser thread
+    std::thread parser;  ///< Runs run_scene_parser()
+    ComponentsByName components;  ///< Loadable types (snapshot taken when the version is accepted)
+    int version{0};  ///< Validated scene version (0 until the first step succeeds)
+    bool done{false};  ///< All entities loaded or failed
+};
+
+SceneStreamLoader::SceneStreamLoader(World& world, const std::filesystem::path& path, std::size_t max_pending)
+    : world_(world), impl_(std::make_unique<Impl>()) {
+    LOG_INFO("Streaming scene from: {}", path.string());
+    impl_->state.max_pending = std::max<std::size_t>(max_pending, 1);
+    if (!std::filesystem::exists(path)) {
+        LOG_ERROR("Scene file not found: {}", path.string());
+        impl_->state.error = SerializationError::FILE_NOT_FOUND;
+        impl_->state.finished = true;
+        return;
+    }
+    impl_->parser = std::thread(run_scene_parser, std::ref(impl_->state), path);
+}
+
+SceneStreamLoader::~SceneStreamLoader() {
+    {
+        std::scoped_lock lock(impl_->state.mutex);
+        impl_->state.cancelled = true;
+    }
+    impl_->state.changed.notify_all();
+    if (impl_->parser.joinable()) {
+        impl_->parser.join();
+    }
+}
+
+auto SceneStreamLoader::step(std::size_t max_entities) -> std::expected<bool, SerializationError> {
+    auto& state = impl_->state;
+    if (impl_->done) {
+        return true;
+    }
+    
+    std::vector<YAML::Node> batch;
+    std::optional<SerializationError> error;
+    bool finished = false;
+    {
+        // Map keys are unordered: entities may be parsed before `version`,
+        // so nothing is loaded until it is known (or the file has ended)
+        std::unique_lock lock(state.mutex);
+        state.changed.wait(lock, [&] {
+            return state.finished || ((impl_->version != 0 || state.version) && !state.pending.empty());
+        });
         
-        if (entity_node["Velocity"]) {
-            auto vel = deserialize_velocity(entity_node["Velocity"]);
-            if (vel) {
-                world.add_component(entity, *vel);
+        // The world is only cleared once the version is known to be good
+        if (impl_->version == 0 && !state.error) {
+            if (const auto version = parse_scene_version(state.version); !version) {
+                error = version.error();
             } else {
-                LOG_WARN("Failed to deserialize Velocity for entity {}", entity.id());
+                impl_->version = *version;
+                impl_->components = components_by_name();
+                world_.clear();
             }
         }
         
-        if (entity_node["Name"]) {
-            auto name = deserialize_name(entity_node["Name"]);
-            if (name) {
-                world.add_component(entity, *name);
-            } else {
-                LOG_WARN("Failed to deserialize Name for entity {}", entity.id());
+        const auto count = std::min(std::max<std::size_t>(max_entities, 1), state.pending.size());
+        if (!error && impl_->version != 0) {
+            batch.assign(std::make_move_iterator(state.pending.begin()),
+                         std::make_move_iterator(state.pending.begin() + static_cast<std::ptrdiff_t>(count)));
+            state.pending.erase(state.pending.begin(), state.pending.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        finished = state.finished && state.pending.empty();
+        error = error ? error : (finished ? state.error : std::nullopt);
+    }
+    state.changed.notify_all();  // Room in the queue again
+    
+    for (const auto& entity_node : batch) {
+        loaded_count_ += load_entity(world_, impl_->components, entity_node, impl_->version) ? 1 : 0;
+    }
+    
+    if (error) {
+        impl_->done = true;
+        return std::unexpected(*error);
+    }
+    if (finished) {
+        impl_->done = true;
+        LOG_INFO("Scene streamed successfully ({} entities)", loaded_count_);
+    }
+    return finished;
+}
+
+auto load_scene_streaming(
+    World& world,
+    const std::filesystem::path& path,
+    std::size_t batch_size
+) -> std::expected<void, SerializationError> {
+    SceneStreamLoader loader(world, path, batch_size);
+    while (true) {
+        auto result = loader.step(batch_size);
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        if (*result) {
+            return {};
+        }
+    }
+}
+
+// ========== Parallel Loader ==========
+
+auto load_scene_parallel(
+    World& world,
+    const std::filesystem::path& path,
+    JobSystem& jobs
+) -> std::expected<void, SerializationError> {
+    LOG_INFO("Loading scene in parallel from: {}", path.string());
+    
+    if (!std::filesystem::exists(path)) {
+        LOG_ERROR("Scene file not found: {}", path.string());
+        return std::unexpected(SerializationError::FILE_NOT_FOUND);
+    }
+    
+    // Parse on this thread into one independent node per entity: unlike a
+    // single document tree, separate entities share no YAML memory, so they
+    // can be decoded concurrently
+    SceneStreamState state;
+    state.max_pending = std::numeric_limits<std::size_t>::max();
+    run_scene_parser(state, path);
+    if (state.error) {
+        return std::unexpected(*state.error);
+    }
+    const auto version = parse_scene_version(state.version);
+    if (!version) {
+        return std::unexpected(version.error());
+    }
+    const std::vector<YAML::Node> nodes(std::make_move_iterator(state.pending.begin()),
+                                        std::make_move_iterator(state.pending.end()));
+    state.pending.clear();
+    
+    // Decode ranges into per-job staging buffers
+    const auto components = components_by_name();
+    const std::size_t range_count = nodes.size() < PARALLEL_LOAD_THRESHOLD
+        ? 1
+        : std::min<std::size_t>(nodes.size(), std::max<std::size_t>(jobs.thread_count(), 1) * 4);
+    const std::size_t range_size = (nodes.size() + range_count - 1) / range_count;
+    std::vector<StagedRange> ranges(range_count);
+    const auto decode = [&](std::size_t r) {
+        const std::size_t begin = std::min(r * range_size, nodes.size());
+        stage_entities(components, nodes, begin, std::min(begin + range_size, nodes.size()), *version, ranges[r]);
+    };
+    if (range_count == 1) {
+        decode(0);
+    } else {
+        jobs.parallel_for(0, range_count, 1, decode);
+    }
+    
+    // One structural pass: nothing above touched the world
+    world.clear();
+    const auto loaded_count = commit_staged(world, ranges);
+    
+    LOG_INFO("Scene loaded successfully ({} entities, {} ranges)", loaded_count, range_count);
+    return {};
+}
+
+// ========== Scene Journal ==========
+
+SceneJournal::SceneJournal(std::filesystem::path path, JournalOptions options)
+    : path_(std::move(path)), options_(options) {}
+
+auto SceneJournal::journal_path() const -> std::filesystem::path {
+    auto journal = path_;
+    journal += JOURNAL_SUFFIX;
+    return journal;
+}
+
+auto SceneJournal::capture(const World& world) -> std::unordered_map<u32, SavedEntity> {
+    const auto components = scene_components();
+    std::unordered_map<u32, SavedEntity> state;
+    for (const Entity entity : world.entities()) {
+        SavedEntity saved{.entity = entity, .types = {}};
+        for (const auto& component : components) {
+            if (world.has_component_by_id(entity, component.type_id)) {
+                saved.types.push_back(component.type_id);  // Ascending: registry order
             }
         }
+        if (!saved.types.empty()) {
+            state.emplace(entity.id(), std::move(saved));
+        }
+    }
+    return state;
+}
+
+auto SceneJournal::compact(World& world) -> std::expected<void, SerializationError> {
+    // A fresh epoch orphans every delta of the old journal, so a crash between
+    // the rename and the truncation below cannot replay them onto the new base
+    const auto now = static_cast<u64>(std::chrono::system_clock::now().time_since_epoch().count());
+    const u64 epoch = std::max(now, epoch_ + 1);
+    
+    auto staging = path_;
+    staging += ".tmp";
+    if (auto result = write_scene(world, staging, epoch); !result) {
+        return result;
+    }
+    std::error_code ec;
+    std::filesystem::rename(staging, path_, ec);
+    if (ec) {
+        LOG_ERROR("Failed to replace {}: {}", path_.string(), ec.message());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    if (std::ofstream journal(journal_path(), std::ios::trunc); !journal.is_open()) {
+        LOG_ERROR("Failed to reset journal: {}", journal_path().string());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    
+    epoch_ = epoch;
+    saved_ = capture(world);
+    saved_tick_ = world.change_tick();
+    world.advance_tick();  // Writes made after this save must not share its tick
+    delta_count_ = 0;
+    scene_bytes_ = std::filesystem::file_size(path_, ec);
+    journal_bytes_ = 0;
+    return {};
+}
+
+auto SceneJournal::save(World& world) -> std::expected<JournalWrite, SerializationError> {
+    const auto full = [&]() -> std::expected<JournalWrite, SerializationError> {
+        if (auto result = compact(world); !result) {
+            return std::unexpected(result.error());
+        }
+        return JournalWrite::FULL;
+    };
+    if (epoch_ == 0 || delta_count_ >= options_.max_deltas) {
+        return full();
+    }
+    
+    const auto components = scene_components();
+    const auto& registry = ComponentRegistry::instance();
+    auto current = capture(world);
+    
+    YAML::Emitter out;
+    out << YAML::BeginMap;
+    out << YAML::Key << "epoch" << YAML::Value << epoch_;
+    out << YAML::Key << "delta" << YAML::Value << delta_count_ + 1;
+    out << YAML::Key << "version" << YAML::Value << SCENE_VERSION;
+    out << YAML::Key << "entities" << YAML::Value << YAML::BeginSeq;
+    
+    std::vector<u32> ids;
+    ids.reserve(current.size());
+    for (const auto& [id, entry] : current) {
+        ids.push_back(id);
+    }
+    std::ranges::sort(ids);  // Deterministic output
+    
+    std::size_t changed = 0;
+    for (const u32 id : ids) {
+        const auto& entry = current.at(id);
+        const auto base = saved_.find(id);
+        const bool fresh = base == saved_.end() || base->second.entity != entry.entity;  // New, or ID reused
+        bool open = false;
+        const auto begin_record = [&] {
+            if (!open) {
+                out << YAML::BeginMap << YAML::Key << "id" << YAML::Value << id;
+                if (fresh) {
+                    out << YAML::Key << "replace" << YAML::Value << true;
+                }
+                open = true;
+            }
+        };
         
-        ++loaded_count;
+        for (const u32 type_id : entry.types) {
+            const bool added = fresh || !std::ranges::binary_search(base->second.types, type_id);
+            if (added || world.component_tick_by_id(entry.entity, type_id) > saved_tick_) {
+                begin_record();
+                const auto component = std::ranges::find(components, type_id, &SceneComponent::type_id);
+                emit_component(out, world, entry.entity, *component);
+            }
+        }
+        if (!fresh) {
+            std::vector<u32> dropped;
+            std::ranges::set_difference(base->second.types, entry.types, std::back_inserter(dropped));
+            if (!dropped.empty()) {
+                begin_record();
+                out << YAML::Key << "remove" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+                for (const u32 type_id : dropped) {
+                    out << registry.name(type_id);
+                }
+                out << YAML::EndSeq;
+            }
+        }
+        if (open) {
+            out << YAML::EndMap;
+            ++changed;
+        }
     }
+    out << YAML::EndSeq;
     
-    LOG_INFO("Scene loaded successfully ({} entities)", loaded_count);
+    std::vector<u32> removed;
+    for (const auto& [id, entry] : saved_) {
+        if (!current.contains(id)) {
+            removed.push_back(id);
+        }
+    }
+    std::ranges::sort(removed);
+    out << YAML::Key << "removed" << YAML::Value << YAML::Flow << removed;
+    out << YAML::Key << "end" << YAML::Value << delta_count_ + 1;  // Last line: present only if fully written
+    out << YAML::EndMap;
+    
+    if (changed == 0 && removed.empty()) {
+        saved_tick_ = world.change_tick();
+        world.advance_tick();
+        return JournalWrite::UNCHANGED;
+    }
+    
+    // Once the journal costs more to replay than a rewrite, compact instead
+    const std::string_view text = out.c_str();
+    const auto journal_limit = static_cast<double>(scene_bytes_) * options_.max_journal_ratio;
+    if (static_cast<double>(journal_bytes_ + text.size()) > journal_limit) {
+        return full();
+    }
+    
+    std::ofstream journal(journal_path(), std::ios::app);
+    journal << "---\n" << text << '\n';
+    if (!journal.good()) {
+        LOG_ERROR("Failed to append to journal: {}", journal_path().string());
+        return std::unexpected(SerializationError::FILE_OPEN_FAILED);
+    }
+    
+    journal_bytes_ += text.size() + 5;
+    ++delta_count_;
+    saved_ = std::move(current);
+    saved_tick_ = world.change_tick();
+    world.advance_tick();
+    LOG_INFO("Scene delta {} journaled ({} entities changed, {} removed)", delta_count_, changed, removed.size());
+    return JournalWrite::DELTA;
+}
+
+auto load_scene_journal(
+    World& world,
+    const std::filesystem::path& path
+) -> std::expected<void, SerializationError> {
+    EntityIdMap ids;
+    std::optional<u64> epoch;
+    if (auto result = read_scene(world, path, &ids, &epoch); !result) {
+        return result;
+    }
+    
+    auto journal_path = path;
+    journal_path += JOURNAL_SUFFIX;
+    std::ifstream journal(journal_path, std::ios::binary);
+    if (!epoch || !journal.is_open()) {
+        return {};  // Plain scene, or nothing journaled yet
+    }
+    const std::string text((std::istreambuf_iterator<char>(journal)), std::istreambuf_iterator<char>());
+    
+    // Complete deltas of this epoch by number. A save that failed mid-append
+    // is retried under the same number, so the last copy wins.
+    std::map<u64, YAML::Node> deltas;
+    for (const auto document : split_journal(text)) {
+        try {
+            const YAML::Node delta = YAML::Load(std::string(document));
+            const bool complete = delta.IsMap() && delta["epoch"] && delta["delta"] && delta["entities"]
+                               && delta["end"] && delta["end"].as<u64>() == delta["delta"].as<u64>();
+            if (!complete) {
+                LOG_WARN("Journal {} holds an incomplete delta (interrupted save), ignoring it", journal_path.string());
+                continue;
+            }
+            if (delta["epoch"].as<u64>() == *epoch) {
+                deltas[delta["delta"].as<u64>()] = delta;
+            }  // Else left over from before the last compaction
+        } catch (const YAML::Exception&) {
+            LOG_WARN("Journal {} holds an incomplete delta (interrupted save), ignoring it", journal_path.string());
+        }
+    }
+    
+    // Replay 1, 2, 3, ... up to the first missing number: a later delta
+    // builds on the lost one and cannot be applied without it
+    const auto components = components_by_name();
+    std::size_t applied = 0;
+    for (const auto& [number, delta] : deltas) {
+        if (number != applied + 1) {
+            LOG_WARN("Journal {} is missing delta {}, ignoring {} later deltas", journal_path.string(), applied + 1,
+                     deltas.size() - applied);
+            break;
+        }
+        try {
+            apply_delta(world, components, delta, ids);
+            ++applied;
+        } catch (const YAML::Exception& e) {
+            LOG_ERROR("Malformed journal delta: {}", e.what());
+            return std::unexpected(SerializationError::INVALID_COMPONENT_DATA);
+        }
+    }
+    
+    LOG_INFO("Replayed {} journal deltas", applied);
     return {};
 }
 
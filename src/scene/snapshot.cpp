@@ -0,0 +1,322 @@
+/**
+ * @file snapshot.cpp
+ * @brief World snapshot capture and restore
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/snapshot.hpp>
+#include <luma/scene/world.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace luma::scene {
+
+/**
+ * @brief Captured world state (immutable once published)
+ */
+struct WorldSnapshot::Data {
+    /**
+     * @brief Chunk layout shared by all pages of one archetype
+     */
+    struct Layout {
+        std::vector<ArchetypeColumn> columns;  ///< Columns with chunk offsets
+        std::size_t chunk_bytes{0};  ///< Page allocation size
+    };
+    
+    /**
+     * @brief Copy of one chunk (same byte layout as the chunk)
+     */
+    struct Page {
+        std::shared_ptr<const Layout> layout;  ///< Column offsets and lifetimes
+        std::byte* data{nullptr};  ///< [Entity x count | pad | column blocks...]
+        u32 count{0};  ///< Rows
+        u32 max_tick{0};  ///< Latest column change tick at capture (sharing test)
+        
+        Page(std::shared_ptr<const Layout> page_layout, u32 rows, u32 tick)
+            : layout(std::move(page_layout))
+            , data(static_cast<std::byte*>(::operator new(layout->chunk_bytes, std::align_val_t{CHUNK_ALIGNMENT})))
+            , count(rows)
+            , max_tick(tick) {}
+        
+        ~Page() {
+            for (const auto& col : layout->columns) {
+                if (!col.info.trivially_relocatable) {
+                    for (u32 row = 0; row < count; ++row) {
+                        col.info.destroy(data + col.offset + std::size_t{col.info.size} * row);
+                    }
+                }
+            }
+            ::operator delete(data, std::align_val_t{CHUNK_ALIGNMENT});
+        }
+        
+        Page(const Page&) = delete;
+        Page& operator=(const Page&) = delete;
+        
+        [[nodiscard]] auto entities() const -> const Entity* {
+            return std::launder(reinterpret_cast<const Entity*>(data));
+        }
+    };
+    
+    /**
+     * @brief Captured archetype (index in archetypes matches the world's)
+     */
+    struct ArchetypeImage {
+        ComponentSignature signature;  ///< Archetype signature
+        std::shared_ptr<const Layout> layout;  ///< Shared column layout
+        std::vector<std::shared_ptr<const Page>> pages;  ///< One page per chunk, in row order
+    };
+    
+    std::vector<ArchetypeImage> archetypes;  ///< Archetypes in world index order
+    std::vector<EntityMeta> entity_meta;  ///< Entity ID -> archetype row
+    std::vector<u32> free_entities;  ///< Recyclable IDs
+    std::size_t entity_count{0};  ///< Alive entities
+    std::vector<std::shared_ptr<const SparseSet>> sparse_sets;  ///< Type ID -> sparse-set copy
+    std::vector<std::shared_ptr<const RelationIndex>> relations;  ///< Type ID -> pair index copy
+    u32 tick{0};  ///< World change tick at capture
+    std::size_t page_count{0};  ///< Pages in total
+    std::size_t shared_pages{0};  ///< Pages taken over from the previous snapshot
+};
+
+namespace {
+
+using Data = WorldSnapshot::Data;
+
+/**
+ * @brief Check that a component type can be copied into a snapshot
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto is_copyable(const ComponentTypeInfo& info) -> bool {
+    return info.trivially_relocatable || info.copy_construct != nullptr;
+}
+
+/**
+ * @brief Copy rows [0, count) of one column between blocks with identical layout
+ * 
+ * ⚠️ IMPURE (constructs components in dst)
+ * 
+ * dst/src point at the start of a chunk-layout block (entity list first).
+ * Trivially copyable columns are a single memcpy.
+ */
+auto copy_column(const ArchetypeColumn& col, std::byte* dst, const std::byte* src, u32 count) -> void {
+    const std::size_t size = col.info.size;
+    std::byte* to = dst + col.offset;
+    const std::byte* from = src + col.offset;
+    if (col.info.trivially_relocatable) {
+        std::memcpy(to, from, size * count);
+    } else {
+        for (u32 row = 0; row < count; ++row) {
+            col.info.copy_construct(to + size * row, from + size * row);
+        }
+    }
+}
+
+/**
+ * @brief Copy one chunk into a new page
+ * 
+ * ⚠️ IMPURE (allocates)
+ */
+auto capture_page(const std::shared_ptr<const Data::Layout>& layout, const Chunk& chunk, u32 max_tick)
+    -> std::shared_ptr<const Data::Page> {
+    auto page = std::make_shared<Data::Page>(layout, chunk.size(), max_tick);
+    std::memcpy(page->data, chunk.entities().data(), sizeof(Entity) * chunk.size());
+    
+    // column_raw() points at row 0 of a column; rebase to the chunk start so
+    // offsets line up with the page's identical layout
+    for (const auto& col : layout->columns) {
+        const std::byte* base = chunk.column_raw(col.type_id) - col.offset;
+        copy_column(col, page->data, base, chunk.size());
+    }
+    return page;
+}
+
+/**
+ * @brief Latest change tick of any column of a chunk
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto chunk_tick(const Archetype& archetype, const Chunk& chunk) -> u32 {
+    u32 tick = 0;
+    for (const auto& col : archetype.columns()) {
+        tick = std::max(tick, chunk.changed_tick(col.type_id));
+    }
+    return tick;
+}
+
+} // anonymous namespace
+
+// ========== WorldSnapshot ==========
+
+auto WorldSnapshot::entity_count() const -> std::size_t {
+    return data_ ? data_->entity_count : 0;
+}
+
+auto WorldSnapshot::tick() const -> u32 {
+    return data_ ? data_->tick : 0;
+}
+
+auto WorldSnapshot::page_count() const -> std::size_t {
+    return data_ ? data_->page_count : 0;
+}
+
+auto WorldSnapshot::shared_page_count() const -> std::size_t {
+    return data_ ? data_->shared_pages : 0;
+}
+
+// ========== World ==========
+
+auto World::snapshot() -> Result<WorldSnapshot> {
+    // Refuse before copying anything: a half-built snapshot is useless
+    for (const auto& archetype : archetypes_) {
+        for (const auto& col : archetype->columns()) {
+            if (archetype->size() > 0 && !is_copyable(col.info)) {
+                return std::unexpected(Error{
+                    ErrorCode::SCENE_COMPONENT_NOT_COPYABLE,
+                    "World::snapshot(): archetype column holds a move-only component"
+                });
+            }
+        }
+    }
+    for (const auto& set : sparse_sets_) {
+        if (set && set->size() > 0 && !is_copyable(set->info())) {
+            return std::unexpected(Error{
+                ErrorCode::SCENE_COMPONENT_NOT_COPYABLE,
+                "World::snapshot(): sparse set holds a move-only component"
+            });
+        }
+    }
+    
+    const auto previous = last_snapshot_.lock();
+    auto data = std::make_shared<Data>();
+    data->archetypes.reserve(archetypes_.size());
+    
+    for (std::size_t a = 0; a < archetypes_.size(); ++a) {
+        const Archetype& archetype = *archetypes_[a];
+        
+        // Same index + same signature in the previous snapshot = same layout
+        const Data::ArchetypeImage* old = nullptr;
+        if (previous && a < previous->archetypes.size() && previous->archetypes[a].signature == archetype.signature()) {
+            old = &previous->archetypes[a];
+        }
+        
+        Data::ArchetypeImage image{
+            .signature = archetype.signature(),
+            .layout = old ? old->layout : std::make_shared<const Data::Layout>(Data::Layout{
+                .columns = {archetype.columns().begin(), archetype.columns().end()},
+                .chunk_bytes = archetype.chunk_bytes(),
+            }),
+            .pages = {},
+        };
+        image.pages.reserve(archetype.chunk_count());
+        
+        for (std::size_t c = 0; c < archetype.chunk_count(); ++c) {
+            const Chunk& chunk = archetype.chunk(c);
+            const u32 max_tick = chunk_tick(archetype, chunk);
+            
+            // Unwritten since the last capture (ticks advance after every
+            // snapshot) and holding the same rows: share the old page
+            if (old && c < old->pages.size()) {
+                const auto& page = old->pages[c];
+                if (page->count == chunk.size() && page->max_tick == max_tick
+                    && std::memcmp(page->entities(), chunk.entities().data(), sizeof(Entity) * chunk.size()) == 0) {
+                    image.pages.push_back(page);
+                    ++data->shared_pages;
+                    continue;
+                }
+            }
+            image.pages.push_back(capture_page(image.layout, chunk, max_tick));
+        }
+        
+        data->page_count += image.pages.size();
+        data->archetypes.push_back(std::move(image));
+    }
+    
+    data->entity_meta = entity_meta_;
+    data->free_entities = free_entities_;
+    data->entity_count = entity_count_;
+    
+    data->sparse_sets.resize(sparse_sets_.size());
+    for (std::size_t i = 0; i < sparse_sets_.size(); ++i) {
+        if (sparse_sets_[i]) {
+            data->sparse_sets[i] = sparse_sets_[i]->clone();
+        }
+    }
+    data->relations.resize(relations_.size());
+    for (std::size_t i = 0; i < relations_.size(); ++i) {
+        if (relations_[i]) {
+            data->relations[i] = std::make_shared<const RelationIndex>(*relations_[i]);
+        }
+    }
+    
+    data->tick = change_tick_;
+    last_snapshot_ = data;
+    advance_tick();  // Later writes must not share the captured tick
+    return WorldSnapshot{std::move(data)};
+}
+
+auto World::restore(const WorldSnapshot& snapshot) -> void {
+    clear();
+    if (snapshot.empty()) {
+        return;
+    }
+    
+    const Data& data = *snapshot.data_;
+    change_tick_ = std::max(change_tick_, data.tick) + 1;  // Restored rows read as a fresh write
+    
+    // Recreate archetypes in index order so captured EntityMeta stays valid.
+    // A capture taken while compact() drains an archetype holds its
+    // signature twice; the later copy stays out of the map, and the next
+    // pass drains it.
+    for (const auto& image : data.archetypes) {
+        const auto index = static_cast<u32>(archetypes_.size());
+        archetypes_.push_back(std::make_unique<Archetype>(image.signature, image.layout->columns));
+        archetype_map_.try_emplace(image.signature, index);
+        Archetype& archetype = *archetypes_[index];
+        
+        for (const auto& page : image.pages) {
+            // Pages are full except the last, so each one fills exactly one chunk
+            const Entity* entities = page->entities();
+            u32 first = 0;
+            for (u32 row = 0; row < page->count; ++row) {
+                const u32 placed = archetype.add_entity(entities[row]);
+                first = row == 0 ? placed : first;
+            }
+            if (page->count == 0) {
+                continue;
+            }
+            
+            Chunk& chunk = archetype.chunk(first / archetype.chunk_capacity());
+            for (const auto& col : archetype.columns()) {
+                std::byte* base = chunk.column_raw(col.type_id) - col.offset;
+                copy_column(col, base, page->data, page->count);
+                chunk.mark_column_changed(col.type_id, change_tick_);
+            }
+        }
+    }
+    
+    entity_meta_ = data.entity_meta;
+    free_entities_ = data.free_entities;
+    entity_count_ = data.entity_count;
+    
+    sparse_sets_.resize(data.sparse_sets.size());
+    for (std::size_t i = 0; i < data.sparse_sets.size(); ++i) {
+        if (data.sparse_sets[i]) {
+            sparse_sets_[i] = data.sparse_sets[i]->clone();
+            for (u32 row = 0; row < sparse_sets_[i]->size(); ++row) {
+                sparse_sets_[i]->mark_changed(row, change_tick_);
+            }
+        }
+    }
+    relations_.resize(data.relations.size());
+    for (std::size_t i = 0; i < data.relations.size(); ++i) {
+        if (data.relations[i]) {
+            relations_[i] = std::make_unique<RelationIndex>(*data.relations[i]);
+        }
+    }
+}
+
+} // namespace luma::scene
@@ -0,0 +1,174 @@
+/**
+ * @file sparse_set.cpp
+ * @brief Sparse-set component storage implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/sparse_set.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace luma::scene {
+
+namespace {
+
+/**
+ * @brief Allocation alignment for packed components (at least a cache line)
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto storage_alignment(const ComponentTypeInfo& info) -> std::align_val_t {
+    return std::align_val_t{std::max<std::size_t>(info.alignment, CHUNK_ALIGNMENT)};
+}
+
+} // anonymous namespace
+
+SparseSet::SparseSet(u32 type_id, ComponentTypeInfo info)
+    : type_id_(type_id)
+    , info_(info) {}
+
+SparseSet::~SparseSet() {
+    clear();
+    if (data_) {
+        ::operator delete(data_, storage_alignment(info_));
+    }
+}
+
+auto SparseSet::slot(u32 id) -> u32& {
+    const u32 page = id / PAGE_SIZE;
+    if (page >= pages_.size()) {
+        pages_.resize(page + 1);
+    }
+    if (!pages_[page]) {
+        pages_[page] = std::make_unique<u32[]>(PAGE_SIZE);
+        std::fill_n(pages_[page].get(), PAGE_SIZE, ABSENT);
+    }
+    return pages_[page][id % PAGE_SIZE];
+}
+
+auto SparseSet::reserve(std::size_t count) -> void {
+    if (count <= capacity_) {
+        return;
+    }
+    
+    const std::size_t capacity = std::max<std::size_t>({count, capacity_ * 2, 16});
+    auto* data = static_cast<std::byte*>(::operator new(capacity * info_.size, storage_alignment(info_)));
+    for (std::size_t i = 0; i < entities_.size(); ++i) {
+        info_.relocate_to(data + i * info_.size, data_ + i * info_.size);
+    }
+    
+    if (data_) {
+        ::operator delete(data_, storage_alignment(info_));
+    }
+    data_ = data;
+    capacity_ = capacity;
+}
+
+auto SparseSet::acquire(Entity entity, u32 tick) -> void* {
+    u32& index = slot(entity.id());
+    
+    // Replace in place: the old component dies, its slot is reused
+    if (index != ABSENT) {
+        void* existing = at(index);
+        info_.destroy(existing);
+        entities_[index] = entity;
+        ticks_[index] = tick;
+        return existing;
+    }
+    
+    reserve(entities_.size() + 1);
+    index = static_cast<u32>(entities_.size());
+    entities_.push_back(entity);
+    ticks_.push_back(tick);
+    return at(index);
+}
+
+auto SparseSet::erase(Entity entity) -> bool {
+    const u32 index = index_of(entity);
+    if (index == ABSENT) {
+        return false;
+    }
+    
+    // Swap-pop: relocate the last component into the hole
+    const u32 last = static_cast<u32>(entities_.size() - 1);
+    info_.destroy(at(index));
+    if (index != last) {
+        info_.relocate_to(at(index), at(last));
+        entities_[index] = entities_[last];
+        ticks_[index] = ticks_[last];
+        slot(entities_[index].id()) = index;
+    }
+    entities_.pop_back();
+    ticks_.pop_back();
+    slot(entity.id()) = ABSENT;
+    return true;
+}
+
+auto SparseSet::clear() -> void {
+    for (u32 i = 0; i < entities_.size(); ++i) {
+        info_.destroy(at(i));
+        slot(entities_[i].id()) = ABSENT;
+    }
+    entities_.clear();
+    ticks_.clear();
+}
+
+auto SparseSet::shrink() -> void {
+    // Repack components into an exactly sized block (an empty set frees it)
+    if (capacity_ > entities_.size()) {
+        std::byte* data = nullptr;
+        if (!entities_.empty()) {
+            data = static_cast<std::byte*>(::operator new(entities_.size() * info_.size, storage_alignment(info_)));
+            for (std::size_t i = 0; i < entities_.size(); ++i) {
+                info_.relocate_to(data + i * info_.size, data_ + i * info_.size);
+            }
+        }
+        if (data_) {
+            ::operator delete(data_, storage_alignment(info_));
+        }
+        data_ = data;
+        capacity_ = entities_.size();
+    }
+    entities_.shrink_to_fit();
+    ticks_.shrink_to_fit();
+    
+    // Drop sparse pages that map no entity, then trailing empty page slots
+    for (auto& page : pages_) {
+        if (page && std::all_of(page.get(), page.get() + PAGE_SIZE, [](u32 index) { return index == ABSENT; })) {
+            page.reset();
+        }
+    }
+    while (!pages_.empty() && !pages_.back()) {
+        pages_.pop_back();
+    }
+    pages_.shrink_to_fit();
+}
+
+auto SparseSet::clone() const -> std::unique_ptr<SparseSet> {
+    auto copy = std::make_unique<SparseSet>(type_id_, info_);
+    copy->reserve(entities_.size());
+    if (info_.trivially_relocatable && !entities_.empty()) {
+        std::memcpy(copy->data_, data_, entities_.size() * info_.size);
+    } else {
+        for (u32 i = 0; i < entities_.size(); ++i) {
+            info_.copy_construct(copy->at(i), at(i));
+        }
+    }
+    copy->entities_ = entities_;
+    copy->ticks_ = ticks_;
+    
+    copy->pages_.resize(pages_.size());
+    for (std::size_t page = 0; page < pages_.size(); ++page) {
+        if (pages_[page]) {
+            copy->pages_[page] = std::make_unique<u32[]>(PAGE_SIZE);
+            std::copy_n(pages_[page].get(), PAGE_SIZE, copy->pages_[page].get());
+        }
+    }
+    return copy;
+}
+
+} // namespace luma::scene
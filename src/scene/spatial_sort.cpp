@@ -0,0 +1,88 @@
+/**
+ * @file spatial_sort.cpp
+ * @brief Space-filling-curve row order implementation
+ * 
+ * @author LukeFrankio
+ * @date 2025-10-08
+ */
+
+#include <luma/scene/spatial_sort.hpp>
+
+#include <limits>
+#include <utility>
+
+namespace luma::scene {
+
+namespace {
+
+/**
+ * @brief Quantize one coordinate to [0, SPATIAL_KEY_MAX]
+ * 
+ * ✨ PURE FUNCTION ✨
+ */
+auto quantize(f32 value, f32 lo, f32 hi) -> u32 {
+    const f32 extent = hi - lo;
+    const f32 t = extent > 0.0f ? (value - lo) / extent : 0.0f;
+    // Written so NaN fails the first test and lands on 0
+    if (!(t > 0.0f)) {
+        return 0;
+    }
+    return t < 1.0f ? static_cast<u32>(t * static_cast<f32>(SPATIAL_KEY_MAX)) : SPATIAL_KEY_MAX;
+}
+
+/**
+ * @brief Bounds of every table-stored Transform position
+ * 
+ * ✨ PURE FUNCTION ✨
+ * 
+ * @return {lo, hi}; lo > hi when the world has no Transform rows
+ */
+auto transform_bounds(const World& world) -> std::pair<vec3, vec3> {
+    vec3 lo{std::numeric_limits<f32>::max()};
+    vec3 hi{std::numeric_limits<f32>::lowest()};
+    const u32 type_id = component_id<Transform>();
+    for (std::size_t a = 0; a < world.archetype_count(); ++a) {
+        const Archetype& archetype = world.archetype(a);
+        if (!archetype.has_component_array(type_id)) {
+            continue;
+        }
+        for (std::size_t c = 0; c < archetype.chunk_count(); ++c) {
+            for (const Transform& transform : archetype.chunk(c).column<Transform>(type_id)) {
+                lo = glm::min(lo, transform.position);
+                hi = glm::max(hi, transform.position);
+            }
+        }
+    }
+    return {lo, hi};
+}
+
+} // anonymous namespace
+
+auto spatial_key(const vec3& position, const vec3& lo, const vec3& hi, SpaceFillingCurve curve) -> u64 {
+    const u32 x = quantize(position.x, lo.x, hi.x);
+    const u32 y = quantize(position.y, lo.y, hi.y);
+    const u32 z = quantize(position.z, lo.z, hi.z);
+    return curve == SpaceFillingCurve::HILBERT ? hilbert_encode(x, y, z) : morton_encode(x, y, z);
+}
+
+auto spatial_row_key(const World& world, SpaceFillingCurve curve) -> World::RowKey {
+    const auto [lo, hi] = transform_bounds(world);
+    return [&world, lo, hi, curve](Entity entity) -> u64 {
+        const auto* transform = world.get_component<Transform>(entity);
+        return transform ? spatial_key(transform->position, lo, hi, curve) : 0;
+    };
+}
+
+auto spatial_sort(World& world, SpaceFillingCurve curve) -> std::size_t {
+    const auto key = spatial_row_key(world, curve);
+    const u32 type_id = component_id<Transform>();
+    std::size_t sorted = 0;
+    for (u32 a = 0; a < world.archetype_count(); ++a) {
+        if (world.archetype(a).has_component_array(type_id) && world.sort_rows(a, key)) {
+            ++sorted;
+        }
+    }
+    return sorted;
+}
+
+} // namespace luma::scene
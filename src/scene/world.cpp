@@ -10,21 +10,11 @@
 #include <luma/scene/archetype.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <numeric>
 
 namespace luma::scene {
 
-// Component type registry (global)
-// Maps component types to unique IDs
-namespace {
-    static u32 g_next_component_id = 0;
-    
-    template<typename T>
-    auto get_component_id() -> u32 {
-        static const u32 id = g_next_component_id++;
-        return id;
-    }
-}
-
 World::World() = default;
 World::~World() = default;
 
@@ -46,10 +36,10 @@ auto World::create_entity() -> Entity {
     // Create new entity (IDs start at 1, 0 is reserved for NULL_ENTITY)
     // Vector index = ID - 1 (so entity ID 1 is at index 0)
     const auto id = static_cast<u32>(entity_meta_.size() + 1);
-    entity_meta_.push_back(EntityMeta{0, INVALID_ARCHETYPE, 0});
+    entity_meta_.push_back(EntityMeta{released_generation_, INVALID_ARCHETYPE, 0});
     entity_count_++;
     
-    return Entity::create(id, 0);
+    return Entity::create(id, released_generation_);
 }
 
 auto World::destroy_entity(Entity entity) -> void {
@@ -72,6 +62,20 @@ auto World::destroy_entity(Entity entity) -> void {
         }
     }
     
+    // Drop sparse-set components (few sparse types, so a scan is cheap)
+    for (auto& set : sparse_sets_) {
+        if (set) {
+            set->erase(entity);
+        }
+    }
+    
+    // Drop relationship pairs in both directions (reverse index makes this O(pairs))
+    for (auto& relation : relations_) {
+        if (relation) {
+            relation->erase_entity(entity);
+        }
+    }
+    
     // Mark entity as destroyed (increment generation to invalidate old handles)
     meta.generation++;
     meta.archetype_index = INVALID_ARCHETYPE;
@@ -93,6 +97,63 @@ auto World::is_alive(Entity entity) const -> bool {
     return entity_meta_[id - 1].generation == entity.generation();  // Convert ID to index
 }
 
+auto World::has_component_by_id(Entity entity, u32 type_id) const -> bool {
+    if (!is_alive(entity)) {
+        return false;
+    }
+    if (const auto* set = sparse_set(type_id)) {
+        return set->contains(entity);
+    }
+    const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+    return meta.archetype_index != INVALID_ARCHETYPE && archetypes_[meta.archetype_index]->signature().test(type_id);
+}
+
+auto World::get_component_by_id(Entity entity, u32 type_id) const -> const void* {
+    if (!is_alive(entity)) {
+        return nullptr;
+    }
+    if (const auto* set = sparse_set(type_id)) {
+        const u32 index = set->index_of(entity);
+        return index != SparseSet::ABSENT ? set->at(index) : nullptr;
+    }
+    const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+    if (meta.archetype_index == INVALID_ARCHETYPE) {
+        return nullptr;
+    }
+    return archetypes_[meta.archetype_index]->component_raw(type_id, meta.entity_index);
+}
+
+auto World::component_tick_by_id(Entity entity, u32 type_id) const -> u32 {
+    if (!is_alive(entity)) {
+        return 0;
+    }
+    if (const auto* set = sparse_set(type_id)) {
+        const u32 index = set->index_of(entity);
+        return index != SparseSet::ABSENT ? set->tick(index) : 0;
+    }
+    const auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+    if (meta.archetype_index == INVALID_ARCHETYPE) {
+        return 0;
+    }
+    return archetypes_[meta.archetype_index]->component_tick(type_id, meta.entity_index);
+}
+
+auto World::entities() const -> std::vector<Entity> {
+    std::vector<bool> is_free(entity_meta_.size(), false);
+    for (const u32 id : free_entities_) {
+        is_free[id - 1] = true;
+    }
+    
+    std::vector<Entity> alive;
+    alive.reserve(entity_count_);
+    for (u32 index = 0; index < entity_meta_.size(); ++index) {
+        if (!is_free[index]) {
+            alive.push_back(Entity::create(index + 1, entity_meta_[index].generation));
+        }
+    }
+    return alive;
+}
+
 auto World::entity_count() const -> std::size_t {
     return entity_count_;
 }
@@ -100,25 +161,351 @@ auto World::entity_count() const -> std::size_t {
 auto World::clear() -> void {
     archetypes_.clear();
     archetype_map_.clear();
+    root_add_edges_.clear();
+    ++archetype_epoch_;  // Cached queries must rebuild
+    sparse_sets_.clear();
+    relations_.clear();
     entity_meta_.clear();
     free_entities_.clear();
     entity_count_ = 0;
+    compact_ = {};  // Cursors point into the old state
+}
+
+auto World::remove_component_by_id(Entity entity, u32 type_id) -> void {
+    if (!is_alive(entity)) {
+        return;
+    }
+    
+    // Sparse-set component: no archetype change
+    if (auto* set = sparse_set(type_id)) {
+        set->erase(entity);
+        return;
+    }
+    
+    auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+    if (meta.archetype_index == INVALID_ARCHETYPE
+        || !archetypes_[meta.archetype_index]->signature().test(type_id)) {
+        return;
+    }
+    
+    auto& old_archetype = *archetypes_[meta.archetype_index];
+    
+    // If it was the only component, just remove from current archetype
+    if (old_archetype.signature().count() == 1) {
+        const auto swapped_entity = old_archetype.remove_entity(meta.entity_index);
+        if (swapped_entity != NULL_ENTITY) {
+            auto& swapped_meta = entity_meta_[swapped_entity.id() - 1];
+            swapped_meta.entity_index = meta.entity_index;
+        }
+        meta.archetype_index = INVALID_ARCHETYPE;
+        meta.entity_index = 0;
+        return;
+    }
+    
+    // Resolve destination archetype (source - component) and move entity there
+    move_entity_to_archetype(entity, archetype_without_component(meta.archetype_index, type_id));
+}
+
+auto World::add_component_by_id(Entity entity, u32 type_id, void* component) -> bool {
+    if (!is_alive(entity)) {
+        return false;
+    }
+    
+    auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+    const auto info = ComponentRegistry::instance().info(type_id);
+    
+    if (info.storage == StoragePolicy::SPARSE) {
+        sparse_set_for(type_id, info).insert(entity, component, change_tick_);
+        return true;
+    }
+    
+    // Tags only need the signature bit; the recorded object is dropped
+    if (info.storage == StoragePolicy::TAG) {
+        if (meta.archetype_index == INVALID_ARCHETYPE || !archetypes_[meta.archetype_index]->signature().test(type_id)) {
+            move_entity_to_archetype(entity, archetype_with_component(meta.archetype_index, type_id));
+        }
+        info.destroy(component);
+        return true;
+    }
+    
+    // Replace in place if entity already has this component (no migration)
+    if (meta.archetype_index != INVALID_ARCHETYPE) {
+        auto& archetype = *archetypes_[meta.archetype_index];
+        if (auto* existing = archetype.component_raw(type_id, meta.entity_index)) {
+            info.destroy(existing);
+            info.relocate_to(existing, component);
+            archetype.mark_changed(type_id, meta.entity_index, change_tick_);
+            return true;
+        }
+    }
+    
+    const u32 new_archetype_idx = archetype_with_component(meta.archetype_index, type_id);
+    move_entity_to_archetype(entity, new_archetype_idx);
+    
+    auto& archetype = *archetypes_[new_archetype_idx];
+    info.relocate_to(archetype.component_raw(type_id, meta.entity_index), component);
+    archetype.mark_changed(type_id, meta.entity_index, change_tick_);
+    return true;
+}
+
+auto World::archetype_for_ids(std::span<const u32> type_ids) -> u32 {
+    ComponentSignature signature;
+    std::vector<ArchetypeColumn> columns;
+    columns.reserve(type_ids.size());
+    for (const auto type_id : type_ids) {
+        if (signature.test(type_id)) {
+            continue;  // Repeated ID: one column per type
+        }
+        const auto info = ComponentRegistry::instance().info(type_id);
+        if (info.storage == StoragePolicy::SPARSE) {
+            continue;  // Lives in its sparse set, not in the archetype
+        }
+        signature.set(type_id);
+        if (info.storage == StoragePolicy::TABLE) {
+            columns.push_back(ArchetypeColumn{.type_id = type_id, .info = info});
+        }
+    }
+    
+    if (signature.empty()) {
+        return INVALID_ARCHETYPE;
+    }
+    if (auto it = archetype_map_.find(signature); it != archetype_map_.end()) {
+        return it->second;
+    }
+    return get_or_create_archetype(signature, std::move(columns));
+}
+
+auto World::spawn_columns(std::span<const u32> type_ids, u32 count, const ColumnFill& fill) -> std::vector<Entity> {
+    std::vector<Entity> entities;
+    entities.reserve(count);
+    entity_meta_.reserve(entity_meta_.size() + count);
+    
+    const u32 archetype_index = archetype_for_ids(type_ids);
+    if (archetype_index == INVALID_ARCHETYPE) {
+        for (u32 i = 0; i < count; ++i) {
+            entities.push_back(create_entity());
+        }
+        return entities;
+    }
+    
+    Archetype& archetype = *archetypes_[archetype_index];
+    const u32 capacity = archetype.chunk_capacity();
+    for (u32 done = 0; done < count;) {
+        // Fill up the current chunk, then move on to the next one
+        const auto first_row = static_cast<u32>(archetype.size());
+        const u32 run = std::min(capacity - first_row % capacity, count - done);
+        for (u32 i = 0; i < run; ++i) {
+            const Entity entity = create_entity();
+            place_entity(entity, archetype_index);
+            entities.push_back(entity);
+        }
+        
+        Chunk& chunk = archetype.chunk(first_row / capacity);
+        for (const auto& col : archetype.columns()) {
+            fill(col.type_id, archetype.component_raw(col.type_id, first_row), done, run);
+        }
+        
+        // A fresh chunk is all new rows: one column-wide tick instead of one per row
+        if (first_row % capacity == 0) {
+            for (const auto& col : archetype.columns()) {
+                chunk.mark_column_changed(col.type_id, change_tick_);
+            }
+        } else {
+            for (u32 row = first_row; row < first_row + run; ++row) {
+                archetype.mark_row_changed(row, change_tick_);
+            }
+        }
+        done += run;
+    }
+    return entities;
+}
+
+auto World::spawn_by_ids(
+    u32 archetype_index,
+    std::span<const u32> type_ids,
+    std::span<void* const> components
+) -> Entity {
+    const Entity entity = create_entity();
+    Archetype* archetype = nullptr;
+    u32 index = 0;
+    if (archetype_index != INVALID_ARCHETYPE) {
+        index = place_entity(entity, archetype_index);
+        archetype = archetypes_[archetype_index].get();
+    }
+    
+    ComponentSignature placed;
+    for (std::size_t i = 0; i < type_ids.size(); ++i) {
+        const auto info = ComponentRegistry::instance().info(type_ids[i]);
+        if (placed.test(type_ids[i])) {
+            info.destroy(components[i]);  // Repeated type: the first one is kept
+            continue;
+        }
+        placed.set(type_ids[i]);
+        switch (info.storage) {
+            case StoragePolicy::TABLE:
+                info.relocate_to(archetype->component_raw(type_ids[i], index), components[i]);
+                break;
+            case StoragePolicy::SPARSE:
+                sparse_set_for(type_ids[i], info).insert(entity, components[i], change_tick_);
+                break;
+            case StoragePolicy::TAG:
+                info.destroy(components[i]);  // Signature bit already set by the archetype
+                break;
+        }
+    }
+    if (archetype) {
+        archetype->mark_row_changed(index, change_tick_);
+    }
+    
+    return entity;
+}
+
+auto World::sparse_set_for(u32 type_id, const ComponentTypeInfo& info) -> SparseSet& {
+    if (type_id >= sparse_sets_.size()) {
+        sparse_sets_.resize(type_id + 1);
+    }
+    auto& set = sparse_sets_[type_id];
+    if (!set) {
+        set = std::make_unique<SparseSet>(type_id, info);
+    }
+    return *set;
 }
 
-auto World::get_or_create_archetype(ComponentSignature signature) -> u32 {
+auto World::relation_index_for(u32 type_id, bool exclusive) -> RelationIndex& {
+    if (type_id >= relations_.size()) {
+        relations_.resize(type_id + 1);
+    }
+    auto& index = relations_[type_id];
+    if (!index) {
+        index = std::make_unique<RelationIndex>(exclusive);
+    }
+    return *index;
+}
+
+auto World::matching_chunks(const ComponentSignature& required) const -> std::vector<Chunk*> {
+    std::vector<Chunk*> chunks;
+    for (const auto& archetype : archetypes_) {
+        if (!archetype->signature().contains(required)) {
+            continue;
+        }
+        for (std::size_t c = 0; c < archetype->chunk_count(); ++c) {
+            chunks.push_back(&archetype->chunk(c));
+        }
+    }
+    return chunks;
+}
+
+auto World::run_parallel(
+    JobSystem& jobs,
+    std::size_t count,
+    const std::function<void(std::size_t)>& work
+) -> void {
+    if (count == 0) {
+        return;
+    }
+    
+    // A few batches per worker balances uneven chunks while keeping the
+    // number of in-flight jobs far below the job queue capacity
+    constexpr std::size_t BATCHES_PER_THREAD = 4;
+    const std::size_t batches = std::max<std::size_t>(jobs.thread_count(), 1) * BATCHES_PER_THREAD;
+    const std::size_t batch_size = std::max<std::size_t>((count + batches - 1) / batches, 1);
+    
+    jobs.parallel_for(0, count, batch_size, work);
+}
+
+auto World::get_or_create_archetype(
+    const ComponentSignature& signature,
+    std::vector<ArchetypeColumn> columns
+) -> u32 {
     // Check if archetype already exists
     if (auto it = archetype_map_.find(signature); it != archetype_map_.end()) {
         return it->second;
     }
     
-    // Create new archetype
+    // Create new archetype (chunk layout is fixed from here on)
     const auto index = static_cast<u32>(archetypes_.size());
-    archetypes_.push_back(std::make_unique<Archetype>(signature));
+    archetypes_.push_back(std::make_unique<Archetype>(signature, std::move(columns)));
     archetype_map_[signature] = index;
     
     return index;
 }
 
+auto World::archetype_with_component(u32 archetype_index, u32 type_id) -> u32 {
+    // Fast path: follow cached graph edge
+    if (archetype_index == INVALID_ARCHETYPE) {
+        if (type_id < root_add_edges_.size() && root_add_edges_[type_id] != INVALID_ARCHETYPE) {
+            return root_add_edges_[type_id];
+        }
+    } else if (const auto cached = archetypes_[archetype_index]->add_edge(type_id);
+               cached != INVALID_ARCHETYPE) {
+        return cached;
+    }
+    
+    // Slow path: build destination description and look it up by signature
+    ComponentSignature signature;
+    std::vector<ArchetypeColumn> columns;
+    
+    if (archetype_index != INVALID_ARCHETYPE) {
+        const auto& source = *archetypes_[archetype_index];
+        signature = source.signature();
+        columns.assign(source.columns().begin(), source.columns().end());
+    }
+    
+    signature.set(type_id);
+    if (const auto info = ComponentRegistry::instance().info(type_id); info.storage != StoragePolicy::TAG) {
+        columns.push_back(ArchetypeColumn{.type_id = type_id, .info = info});
+    }
+    
+    const auto destination = get_or_create_archetype(signature, std::move(columns));
+    
+    // Cache edge in both directions
+    if (archetype_index == INVALID_ARCHETYPE) {
+        if (type_id >= root_add_edges_.size()) {
+            root_add_edges_.resize(type_id + 1, INVALID_ARCHETYPE);
+        }
+        root_add_edges_[type_id] = destination;
+    } else {
+        archetypes_[archetype_index]->set_add_edge(type_id, destination);
+        archetypes_[destination]->set_remove_edge(type_id, archetype_index);
+    }
+    
+    return destination;
+}
+
+auto World::archetype_without_component(u32 archetype_index, u32 type_id) -> u32 {
+    // Fast path: follow cached graph edge
+    if (const auto cached = archetypes_[archetype_index]->remove_edge(type_id);
+        cached != INVALID_ARCHETYPE) {
+        return cached;
+    }
+    
+    // Slow path: build destination description and look it up by signature
+    const auto& source = *archetypes_[archetype_index];
+    const ComponentSignature signature = source.signature().without(type_id);
+    
+    std::vector<ArchetypeColumn> columns;
+    for (const auto& column : source.columns()) {
+        if (column.type_id != type_id) {
+            columns.push_back(column);
+        }
+    }
+    
+    const auto destination = get_or_create_archetype(signature, std::move(columns));
+    
+    // Cache edge in both directions
+    archetypes_[archetype_index]->set_remove_edge(type_id, destination);
+    archetypes_[destination]->set_add_edge(type_id, archetype_index);
+    
+    return destination;
+}
+
+auto World::place_entity(Entity entity, u32 archetype_index) -> u32 {
+    auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+    meta.archetype_index = archetype_index;
+    meta.entity_index = archetypes_[archetype_index]->add_entity(entity);
+    return meta.entity_index;
+}
+
 auto World::move_entity_to_archetype(Entity entity, u32 new_archetype_index) -> void {
     if (!is_alive(entity)) {
         return;
@@ -127,29 +514,21 @@ auto World::move_entity_to_archetype(Entity entity, u32 new_archetype_index) ->
     const auto id = entity.id();
     auto& meta = entity_meta_[id - 1];  // Convert ID to index (IDs start at 1)
     
-    Archetype* old_archetype = nullptr;
-    u32 old_entity_index = 0;
-    
-    // Get old archetype info before removing entity
-    if (meta.archetype_index != INVALID_ARCHETYPE) {
-        old_archetype = archetypes_[meta.archetype_index].get();
-        old_entity_index = meta.entity_index;
-    }
-    
     // Get new archetype
-    auto& new_archetype = archetypes_[new_archetype_index];
+    auto& new_archetype = *archetypes_[new_archetype_index];
     
     // Add entity to new archetype first (to get the new index)
-    const auto new_index = new_archetype->add_entity(entity);
-    
-    // Copy component data from old to new archetype (before removing from old)
-    if (old_archetype) {
-        copy_components_to_archetype(entity, old_archetype, old_entity_index, new_archetype.get());
-    }
+    const auto new_index = new_archetype.add_entity(entity);
     
-    // Remove from old archetype (after copying data)
-    if (old_archetype) {
-        const auto swapped_entity = old_archetype->remove_entity(old_entity_index);
+    if (meta.archetype_index != INVALID_ARCHETYPE) {
+        auto& old_archetype = *archetypes_[meta.archetype_index];
+        const auto old_entity_index = meta.entity_index;
+        
+        // Move component data from old to new archetype (old row is left empty)
+        move_components_to_archetype(old_archetype, old_entity_index, new_archetype, new_index);
+        
+        // Release the emptied row (nothing left to destroy)
+        const auto swapped_entity = old_archetype.release_entity(old_entity_index);
         
         // Update swapped entity's metadata
         if (swapped_entity != NULL_ENTITY) {
@@ -163,75 +542,292 @@ auto World::move_entity_to_archetype(Entity entity, u32 new_archetype_index) ->
     meta.entity_index = new_index;
 }
 
-auto World::copy_components_to_archetype(
-    Entity entity,
-    Archetype* old_archetype,
+auto World::move_components_to_archetype(
+    Archetype& old_archetype,
     u32 old_index,
-    Archetype* new_archetype
+    Archetype& new_archetype,
+    u32 new_index
 ) -> void {
-    const auto old_sig = old_archetype->signature();
-    const auto new_sig = new_archetype->signature();
-    
-    // For each component type, check if it exists in both archetypes
-    // If so, copy the data from old to new
-    
-    // Helper lambda to copy a component if it exists in both archetypes
-    auto copy_if_exists = [&]<typename T>(u32 comp_id) {
-        const ComponentSignature comp_bit = ComponentSignature(1) << comp_id;
+    // Walk the old row: relocate what the new archetype keeps, destroy the rest
+    for (const auto& column : old_archetype.columns()) {
+        auto* old_comp = old_archetype.component_raw(column.type_id, old_index);
+        if (auto* new_comp = new_archetype.component_raw(column.type_id, new_index)) {
+            column.info.relocate_to(new_comp, old_comp);
+            new_archetype.mark_changed(column.type_id, new_index,
+                                       old_archetype.component_tick(column.type_id, old_index));
+        } else {
+            column.info.destroy(old_comp);
+        }
+    }
+}
+
+auto World::compact(std::chrono::microseconds budget, const RowKey& key) -> bool {
+    const auto start = std::chrono::steady_clock::now();
+    while (!compact_step(key)) {
+        // Compare in microseconds: microseconds::max() must not overflow
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        if (elapsed >= budget) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto World::compact_step(const RowKey& key) -> bool {
+    switch (compact_.phase) {
+        case CompactionPhase::ARCHETYPES:
+            if (compact_archetypes_step()) {
+                compact_.phase = CompactionPhase::ROWS;
+                compact_.cursor = 0;
+                compact_.chunk = 0;
+            }
+            return false;
         
-        // Check if component exists in both old and new archetypes
-        if ((old_sig & comp_bit) && (new_sig & comp_bit)) {
-            // Get component from old archetype
-            if (const auto* old_comp = old_archetype->get_component<T>(comp_id, old_index)) {
-                // Ensure new archetype has component array
-                if (!new_archetype->has_component_array(comp_id)) {
-                    new_archetype->add_component_array<T>(comp_id);
+        case CompactionPhase::ROWS:
+            if (compact_.cursor < archetypes_.size()) {
+                if (compact_rows_step(key)) {
+                    ++compact_.cursor;
+                    compact_.chunk = 0;
                 }
-                
-                // Copy component data to new archetype
-                new_archetype->add_component<T>(comp_id, *old_comp);
+                return false;
             }
+            compact_.phase = CompactionPhase::SPARSE_SETS;
+            compact_.cursor = 0;
+            return false;
+        
+        case CompactionPhase::SPARSE_SETS:
+            if (compact_.cursor < sparse_sets_.size()) {
+                if (auto& set = sparse_sets_[compact_.cursor]) {
+                    set->shrink();
+                }
+                ++compact_.cursor;
+                return false;
+            }
+            compact_.phase = CompactionPhase::ENTITIES;
+            compact_.cursor = 0;
+            return false;
+        
+        case CompactionPhase::ENTITIES: {
+            // create_entity() pops from the back: descending order reuses low IDs first
+            std::ranges::sort(free_entities_, std::greater<>{});
+            
+            // Free IDs at the top of the range are released outright; IDs
+            // created later start above their generations, so old handles
+            // to them stay stale
+            std::size_t released = 0;
+            while (released < free_entities_.size() && free_entities_[released] == entity_meta_.size()) {
+                released_generation_ = std::max(released_generation_, entity_meta_.back().generation);
+                entity_meta_.pop_back();
+                ++released;
+            }
+            free_entities_.erase(free_entities_.begin(), free_entities_.begin() + static_cast<std::ptrdiff_t>(released));
+            
+            free_entities_.shrink_to_fit();
+            entity_meta_.shrink_to_fit();
+            archetypes_.shrink_to_fit();
+            compact_ = {};
+            return true;
         }
+    }
+    return true;
+}
+
+auto World::compact_archetypes_step() -> bool {
+    auto& state = compact_;
+    
+    // Drain one chunk of rows (from the tail, so no row is swapped twice)
+    if (state.move_from != INVALID_ARCHETYPE) {
+        auto& from = *archetypes_[state.move_from];
+        const u32 rows = std::min(static_cast<u32>(from.size()), from.chunk_capacity());
+        for (u32 moved = 0; moved < rows; ++moved) {
+            move_entity_to_archetype(from.get_entity(static_cast<u32>(from.size()) - 1), state.move_to);
+        }
+        if (from.size() == 0) {
+            state.move_from = INVALID_ARCHETYPE;
+            state.move_to = INVALID_ARCHETYPE;
+        }
+        return false;
+    }
+    
+    const auto is_mapped = [this](u32 index) {
+        const auto it = archetype_map_.find(archetypes_[index]->signature());
+        return it != archetype_map_.end() && it->second == index;
+    };
+    
+    // Trailing empty archetype: nothing to renumber
+    if (!archetypes_.empty() && archetypes_.back()->size() == 0) {
+        const auto last = static_cast<u32>(archetypes_.size() - 1);
+        if (is_mapped(last)) {
+            archetype_map_.erase(archetypes_[last]->signature());
+        }
+        redirect_archetype(INVALID_ARCHETYPE, last);
+        archetypes_.pop_back();
+        return false;
+    }
+    
+    // First empty slot, or unmapped copy of a signature (left by a restored
+    // mid-drain snapshot): drain copies into the mapped archetype
+    u32 index = 0;
+    while (index < archetypes_.size() && archetypes_[index]->size() > 0 && is_mapped(index)) {
+        ++index;
+    }
+    if (index == archetypes_.size()) {
+        return true;
+    }
+    
+    const auto last = static_cast<u32>(archetypes_.size() - 1);
+    const u32 from = archetypes_[index]->size() > 0 ? index : last;
+    if (!is_mapped(from)) {
+        state.move_from = from;
+        state.move_to = archetype_map_.at(archetypes_[from]->signature());
+        return false;
+    }
+    
+    // Hand the empty slot to the last archetype, then drain the last one into it
+    Archetype& source = *archetypes_[last];
+    if (is_mapped(index)) {
+        archetype_map_.erase(archetypes_[index]->signature());
+    }
+    archetypes_[index] = std::make_unique<Archetype>(
+        source.signature(), std::vector<ArchetypeColumn>(source.columns().begin(), source.columns().end()));
+    archetype_map_[source.signature()] = index;
+    redirect_archetype(last, index);
+    state.move_from = last;
+    state.move_to = index;
+    return false;
+}
+
+auto World::compact_rows_step(const RowKey& key) -> bool {
+    auto& state = compact_;
+    auto& archetype = *archetypes_[state.cursor];
+    const u32 capacity = archetype.chunk_capacity();
+    
+    if (state.chunk == 0) {
+        archetype.shrink();
+        if (!key || archetype.size() < 2) {
+            return true;
+        }
+        state.rows = static_cast<u32>(archetype.size());
+        state.in_order = true;
+        state.keys.clear();
+        state.keys.reserve(state.rows);
+    }
+    
+    // Rows came or went between slices: the plan is stale, sort next pass
+    const auto drop = [&state] {
+        state.keys = {};
+        state.heap = {};
+        state.run_next = {};
+        return true;
     };
+    if (archetype.size() != state.rows) {
+        return drop();
+    }
     
-    // Copy all known component types
-    // Note: Component IDs are assigned in order of first registration
-    copy_if_exists.template operator()<Transform>(World::component_id<Transform>());
-    copy_if_exists.template operator()<Geometry>(World::component_id<Geometry>());
-    copy_if_exists.template operator()<Material>(World::component_id<Material>());
-    copy_if_exists.template operator()<Velocity>(World::component_id<Velocity>());
-    copy_if_exists.template operator()<Name>(World::component_id<Name>());
-}
-
-// Template instantiations for all component types
-template auto World::add_component(Entity, Transform) -> void;
-template auto World::add_component(Entity, Geometry) -> void;
-template auto World::add_component(Entity, Material) -> void;
-template auto World::add_component(Entity, Velocity) -> void;
-template auto World::add_component(Entity, Name) -> void;
-
-template auto World::remove_component<Transform>(Entity) -> void;
-template auto World::remove_component<Geometry>(Entity) -> void;
-template auto World::remove_component<Material>(Entity) -> void;
-template auto World::remove_component<Velocity>(Entity) -> void;
-template auto World::remove_component<Name>(Entity) -> void;
-
-template auto World::has_component<Transform>(Entity) const -> bool;
-template auto World::has_component<Geometry>(Entity) const -> bool;
-template auto World::has_component<Material>(Entity) const -> bool;
-template auto World::has_component<Velocity>(Entity) const -> bool;
-template auto World::has_component<Name>(Entity) const -> bool;
-
-template auto World::get_component<Transform>(Entity) const -> const Transform*;
-template auto World::get_component<Geometry>(Entity) const -> const Geometry*;
-template auto World::get_component<Material>(Entity) const -> const Material*;
-template auto World::get_component<Velocity>(Entity) const -> const Velocity*;
-template auto World::get_component<Name>(Entity) const -> const Name*;
-
-template auto World::get_component<Transform>(Entity) -> Transform*;
-template auto World::get_component<Geometry>(Entity) -> Geometry*;
-template auto World::get_component<Material>(Entity) -> Material*;
-template auto World::get_component<Velocity>(Entity) -> Velocity*;
-template auto World::get_component<Name>(Entity) -> Name*;
+    // Key one chunk and sort it into a run
+    const u32 chunks = (state.rows + capacity - 1) / capacity;
+    const auto run_end = [&](u32 run) { return std::min((run + 1) * capacity, state.rows); };
+    if (state.chunk < chunks) {
+        const u32 first = state.chunk * capacity;
+        for (u32 row = first; row < run_end(state.chunk); ++row) {
+            const Entity entity = archetype.get_entity(row);
+            state.keys.emplace_back(key(entity), entity);
+        }
+        const auto run = std::ranges::subrange(state.keys.begin() + first, state.keys.end());
+        state.in_order = state.in_order && std::ranges::is_sorted(run, {}, &std::pair<u64, Entity>::first)
+                      && (first == 0 || state.keys[first - 1].first <= state.keys[first].first);
+        std::ranges::stable_sort(run, {}, &std::pair<u64, Entity>::first);
+        
+        if (++state.chunk < chunks) {
+            return false;
+        }
+        if (state.in_order) {
+            return drop();  // Already in order: keep chunks (and snapshot pages) untouched
+        }
+        
+        // Merge runs by (key, run): ties keep row order
+        state.heap.clear();
+        state.run_next.resize(chunks);
+        for (u32 run = 0; run < chunks; ++run) {
+            state.run_next[run] = run * capacity;
+            state.heap.emplace_back(state.keys[run * capacity].first, run);
+        }
+        std::ranges::make_heap(state.heap, std::greater<>{});
+        return false;
+    }
+    
+    // Swap the next chunk's worth of entities into place; rows before
+    // `position` are final, so each entity is found at or after it
+    const u32 first = (state.chunk - chunks) * capacity;
+    for (u32 position = first; position < run_end(state.chunk - chunks); ++position) {
+        std::ranges::pop_heap(state.heap, std::greater<>{});
+        const u32 run = state.heap.back().second;
+        state.heap.pop_back();
+        const Entity entity = state.keys[state.run_next[run]++].second;
+        if (state.run_next[run] < run_end(run)) {
+            state.heap.emplace_back(state.keys[state.run_next[run]].first, run);
+            std::ranges::push_heap(state.heap, std::greater<>{});
+        }
+        
+        if (!is_alive(entity)) {
+            return drop();
+        }
+        auto& meta = entity_meta_[entity.id() - 1];  // Convert ID to index (IDs start at 1)
+        if (meta.archetype_index != state.cursor || meta.entity_index < position) {
+            return drop();
+        }
+        if (meta.entity_index != position) {
+            const Entity displaced = archetype.get_entity(position);
+            archetype.swap_rows(position, meta.entity_index);
+            entity_meta_[displaced.id() - 1].entity_index = meta.entity_index;
+            meta.entity_index = position;
+        }
+    }
+    
+    if (++state.chunk < 2 * chunks) {
+        return false;
+    }
+    return drop();
+}
+
+auto World::redirect_archetype(u32 from, u32 to) -> void {
+    std::vector<u32> remap(archetypes_.size());
+    std::iota(remap.begin(), remap.end(), 0u);
+    remap[to] = INVALID_ARCHETYPE;
+    if (from != INVALID_ARCHETYPE) {
+        remap[from] = to;
+    }
+    
+    for (auto& archetype : archetypes_) {
+        archetype->remap_edges(remap);
+    }
+    for (auto& edge : root_add_edges_) {
+        edge = edge < remap.size() ? remap[edge] : INVALID_ARCHETYPE;
+    }
+    ++archetype_epoch_;  // Cached queries hold the old slot
+}
+
+auto World::sort_rows(u32 archetype_index, const RowKey& key) -> bool {
+    auto& archetype = *archetypes_[archetype_index];
+    const auto count = static_cast<u32>(archetype.size());
+    
+    std::vector<u64> keys(count);
+    for (u32 row = 0; row < count; ++row) {
+        keys[row] = key(archetype.get_entity(row));
+    }
+    if (std::ranges::is_sorted(keys)) {
+        return false;  // Already in order: keep chunks (and snapshot pages) untouched
+    }
+    
+    std::vector<u32> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    std::ranges::stable_sort(order, {}, [&keys](u32 row) { return keys[row]; });
+    archetype.reorder(order);
+    
+    for (u32 row = 0; row < count; ++row) {
+        entity_meta_[archetype.get_entity(row).id() - 1].entity_index = row;
+    }
+    return true;
+}
 
 } // namespace luma::scene
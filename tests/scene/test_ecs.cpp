@@ -6,23 +6,98 @@
  * - Entity creation and destruction
  * - Component addition and removal
  * - Entity lifecycle and generation counter
- * - Archetype transitions
- * - Component queries (each<> templates)
+ * - Archetype transitions (component data preserved across migration)
+ * - Component queries (each<> templates, cached Query<> with filters)
+ * - Deferred structural changes (CommandBuffer)
+ * - System scheduling (Schedule waves from declared access)
+ * - Sparse-set storage policy (no migration, mixed queries)
+ * - Zero-size tag components (signature bit, no column)
+ * - Transform hierarchy (depth-level propagation, dirty subtrees)
+ * - Relationship pairs (reverse index, exclusive relations, cleanup)
+ * - World snapshots (restore, copy-on-write page sharing)
+ * - Memory compaction (empty archetypes, row order, time slicing)
+ * - Spatial row sort (Morton / Hilbert keys)
  * - World state management
  * 
  * @author LukeFrankio
  * @date 2025-10-08
  */
 
+#include <luma/core/jobs.hpp>
+#include <luma/scene/command_buffer.hpp>
 #include <luma/scene/world.hpp>
 #include <luma/scene/entity.hpp>
+#include <luma/scene/hierarchy.hpp>
 #include <luma/scene/component.hpp>
+#include <luma/scene/query.hpp>
+#include <luma/scene/registry.hpp>
+#include <luma/scene/schedule.hpp>
+#include <luma/scene/soa.hpp>
+#include <luma/scene/spatial_sort.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 using namespace luma;
 using namespace luma::scene;
 
+// Game-specific components (not known to world.hpp)
+struct Paddle {
+    f32 speed{10.0f};
+};
+
+struct Ball {
+    f32 radius{0.5f};
+};
+
+struct Collider {
+    vec3 half_extents{1.0f, 1.0f, 1.0f};
+    std::string layer{"default"};
+};
+
+// Move-only component (cannot be snapshotted)
+struct Handle {
+    std::unique_ptr<int> resource;
+};
+
+// Relations (labels for entity pairs)
+struct ChildOf {
+    static constexpr bool exclusive_relation = true;
+};
+
+struct CollidesWith {};
+
+// Frequently toggled flags (sparse-set storage)
+struct Hit {
+    static constexpr StoragePolicy storage_policy = StoragePolicy::SPARSE;
+    f32 damage{0.0f};
+};
+
+struct Selected {
+    static constexpr StoragePolicy storage_policy = StoragePolicy::SPARSE;
+    std::string label{"a selection label long enough to live on the heap"};
+};
+
+// Data-less tags (signature bit only)
+struct Static {};
+struct Emissive {};
+
+// Family of distinct types to push component IDs past 64
+template<u32 N>
+struct Marker {
+    u32 value{N};
+};
+
 class ECSTest : public ::testing::Test {
 protected:
     World world;
@@ -69,6 +144,34 @@ TEST_F(ECSTest, EntityReuse) {
     EXPECT_TRUE(world.is_alive(e2));  // New entity valid
 }
 
+TEST_F(ECSTest, GenerationWrapDependsOnHandleWidth) {
+    const auto first = world.create_entity();
+    
+    // Recycle the same ID 256 times
+    Entity latest = first;
+    for (int i = 0; i < 256; ++i) {
+        world.destroy_entity(latest);
+        latest = world.create_entity();
+    }
+    ASSERT_EQ(latest.id(), first.id());
+    
+    if constexpr (sizeof(Entity) == sizeof(u64)) {
+        EXPECT_FALSE(world.is_alive(first));  // 32-bit generation: still stale
+        EXPECT_EQ(latest.generation(), 256u);
+    } else {
+        EXPECT_TRUE(world.is_alive(first));  // 8-bit generation wrapped: known limitation
+        EXPECT_EQ(latest.generation(), 0u);
+    }
+}
+
+TEST(EntityTest, PacksIdAndGeneration) {
+    const auto entity = Entity::create(static_cast<u32>(ENTITY_ID_MASK), 7);
+    EXPECT_EQ(entity.id(), static_cast<u32>(ENTITY_ID_MASK));
+    EXPECT_EQ(entity.generation(), 7u);
+    EXPECT_TRUE(entity.is_valid());
+    EXPECT_EQ(Entity::create(1, 0).value, EntityValue{1});
+}
+
 TEST_F(ECSTest, NullEntityAlwaysDead) {
     EXPECT_FALSE(world.is_alive(NULL_ENTITY));
 }
@@ -124,9 +227,7 @@ TEST_F(ECSTest, MutateComponent) {
     EXPECT_EQ(transform_const->position.x, 5.0f);
 }
 
-// TODO(MVP+1): Fix archetype transitions - currently components are lost when moving between archetypes
-// We need to implement component copying during archetype migrations
-TEST_F(ECSTest, DISABLED_RemoveComponent) {
+TEST_F(ECSTest, RemoveComponent) {
     const auto entity = world.create_entity();
     
     world.add_component(entity, Transform{});
@@ -151,8 +252,7 @@ TEST_F(ECSTest, MultipleComponents) {
 
 // ========== Archetype Tests ==========
 
-// TODO(MVP+1): Fix archetype transitions
-TEST_F(ECSTest, DISABLED_ArchetypeTransition) {
+TEST_F(ECSTest, ArchetypeTransition) {
     const auto entity = world.create_entity();
     
     // Start with Transform
@@ -170,8 +270,7 @@ TEST_F(ECSTest, DISABLED_ArchetypeTransition) {
     EXPECT_TRUE(world.has_component<Velocity>(entity));
 }
 
-// TODO(MVP+1): Fix archetype transitions
-TEST_F(ECSTest, DISABLED_ComponentsPreservedAcrossArchetypes) {
+TEST_F(ECSTest, ComponentsPreservedAcrossArchetypes) {
     const auto entity = world.create_entity();
     
     world.add_component(entity, Transform{.position = {1.0f, 2.0f, 3.0f}});
@@ -187,6 +286,101 @@ TEST_F(ECSTest, DISABLED_ComponentsPreservedAcrossArchetypes) {
     EXPECT_EQ(velocity->linear.x, 4.0f);
 }
 
+TEST_F(ECSTest, NonTrivialComponentSurvivesMigration) {
+    const auto e1 = world.create_entity();
+    const auto e2 = world.create_entity();
+    
+    world.add_component(e1, Name{.value = "a fairly long entity name that defeats SSO"});
+    world.add_component(e2, Name{.value = "second"});
+    world.add_component(e1, Transform{.position = {7.0f, 0.0f, 0.0f}});
+    
+    // e1 migrated out of the Name-only archetype; e2 was swapped into its slot
+    ASSERT_NE(world.get_component<Name>(e1), nullptr);
+    ASSERT_NE(world.get_component<Name>(e2), nullptr);
+    EXPECT_EQ(world.get_component<Name>(e1)->value, "a fairly long entity name that defeats SSO");
+    EXPECT_EQ(world.get_component<Name>(e2)->value, "second");
+    EXPECT_EQ(world.get_component<Transform>(e1)->position.x, 7.0f);
+}
+
+TEST_F(ECSTest, MigrationMovesInsteadOfCopying) {
+    const auto entity = world.create_entity();
+    world.add_component(entity, Name{.value = "a heap-allocated name well past the SSO buffer"});
+    const char* buffer = world.get_component<Name>(entity)->value.data();
+    
+    // Each transition relocates the string; its heap buffer must follow it
+    world.add_component(entity, Transform{});
+    world.add_component(entity, Velocity{});
+    world.remove_component<Transform>(entity);
+    
+    EXPECT_EQ(world.get_component<Name>(entity)->value.data(), buffer);
+    EXPECT_EQ(world.get_component<Name>(entity)->value, "a heap-allocated name well past the SSO buffer");
+}
+
+TEST(ComponentTypeInfoTest, TrivialTypesRelocateByMemcpy) {
+    EXPECT_TRUE(ComponentTypeInfo::of<Transform>().trivially_relocatable);
+    EXPECT_TRUE(ComponentTypeInfo::of<Velocity>().trivially_relocatable);
+    EXPECT_FALSE(ComponentTypeInfo::of<Name>().trivially_relocatable);
+}
+
+TEST_F(ECSTest, AddExistingComponentReplaces) {
+    const auto entity = world.create_entity();
+    
+    world.add_component(entity, Velocity{.linear = {1.0f, 0.0f, 0.0f}});
+    world.add_component(entity, Velocity{.linear = {2.0f, 0.0f, 0.0f}});
+    
+    int count = 0;
+    world.each<Velocity>([&](Entity, const Velocity& velocity) {
+        count++;
+        EXPECT_EQ(velocity.linear.x, 2.0f);
+    });
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(ECSTest, RepeatedTypeIdsMakeOneColumn) {
+    const std::vector<u32> type_ids{component_id<Name>(), component_id<Transform>(), component_id<Name>()};
+    std::size_t name_fills = 0;
+    const auto entities = world.spawn_columns(type_ids, 3, [&](u32 type_id, void* dst, u32 first, u32 count) {
+        for (u32 i = 0; i < count; ++i) {
+            if (type_id == component_id<Name>()) {
+                ::new (static_cast<Name*>(dst) + i) Name{.value = "n" + std::to_string(first + i)};
+                ++name_fills;
+            } else {
+                ::new (static_cast<Transform*>(dst) + i) Transform{};
+            }
+        }
+    });
+    ASSERT_EQ(entities.size(), 3u);
+    EXPECT_EQ(name_fills, 3u);
+    EXPECT_EQ(world.get_component<Name>(entities[2])->value, "n2");
+    
+    world.destroy_entity(entities[0]);  // Row removal must destroy exactly one Name
+    EXPECT_EQ(world.entity_count(), 2u);
+}
+
+TEST_F(ECSTest, ArchetypeGraphReusesTransitions) {
+    const auto e1 = world.create_entity();
+    world.add_component(e1, Transform{});
+    world.add_component(e1, Velocity{});
+    world.add_component(e1, Material{});
+    const auto archetypes_after_first = world.archetype_count();
+    
+    // Same transition chain for more entities must not create archetypes
+    for (int i = 0; i < 100; ++i) {
+        const auto entity = world.create_entity();
+        world.add_component(entity, Transform{.position = {static_cast<f32>(i), 0.0f, 0.0f}});
+        world.add_component(entity, Velocity{});
+        world.add_component(entity, Material{});
+        world.remove_component<Velocity>(entity);
+        world.add_component(entity, Velocity{.linear = {static_cast<f32>(i), 0.0f, 0.0f}});
+        
+        EXPECT_EQ(world.get_component<Transform>(entity)->position.x, static_cast<f32>(i));
+        EXPECT_EQ(world.get_component<Velocity>(entity)->linear.x, static_cast<f32>(i));
+    }
+    
+    // Only {Transform, Material} is new (reached via the remove edge)
+    EXPECT_EQ(world.archetype_count(), archetypes_after_first + 1);
+}
+
 // ========== Query Tests ==========
 
 TEST_F(ECSTest, QuerySingleComponent) {
@@ -256,6 +450,26 @@ TEST_F(ECSTest, QueryEmptyWorld) {
     EXPECT_EQ(count, 0);
 }
 
+TEST_F(ECSTest, QueryAfterDestroyKeepsColumnsAligned) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 8; ++i) {
+        const auto entity = world.create_entity();
+        world.add_component(entity, Transform{.position = {static_cast<f32>(i), 0.0f, 0.0f}});
+        world.add_component(entity, Velocity{.linear = {static_cast<f32>(i), 0.0f, 0.0f}});
+        entities.push_back(entity);
+    }
+    
+    world.destroy_entity(entities[2]);
+    world.destroy_entity(entities[5]);
+    
+    int count = 0;
+    world.each<Transform, Velocity>([&](Entity, const Transform& t, const Velocity& v) {
+        count++;
+        EXPECT_EQ(t.position.x, v.linear.x);  // Same entity's data in both columns
+    });
+    EXPECT_EQ(count, 6);
+}
+
 // ========== World State Tests ==========
 
 TEST_F(ECSTest, WorldClear) {
@@ -381,3 +595,1445 @@ TEST_F(ECSTest, ManyComponents) {
     
     EXPECT_EQ(query_count, COUNT);
 }
+
+// ========== Chunk Storage Tests ==========
+
+TEST_F(ECSTest, ChunksRespectFixedSize) {
+    constexpr std::size_t COUNT = 2000;
+    
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        const auto entity = world.create_entity();
+        world.add_component(entity, Transform{.position = {static_cast<f32>(i), 0.0f, 0.0f}});
+        world.add_component(entity, Velocity{.linear = {static_cast<f32>(i), 0.0f, 0.0f}});
+    }
+    
+    std::size_t chunk_count = 0;
+    std::size_t entity_total = 0;
+    world.each_chunk<Transform, Velocity>([&](std::span<const Entity> entities,
+                                              std::span<const Transform> transforms,
+                                              std::span<const Velocity> velocities) {
+        chunk_count++;
+        entity_total += entities.size();
+        EXPECT_EQ(transforms.size(), entities.size());
+        EXPECT_EQ(velocities.size(), entities.size());
+        
+        // All rows of one chunk fit inside a single CHUNK_SIZE block
+        const auto* begin = reinterpret_cast<const std::byte*>(entities.data());
+        const auto* end = reinterpret_cast<const std::byte*>(velocities.data() + velocities.size());
+        const auto* t_end = reinterpret_cast<const std::byte*>(transforms.data() + transforms.size());
+        EXPECT_LE(static_cast<std::size_t>(std::max(end, t_end) - begin), CHUNK_SIZE);
+        
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            EXPECT_EQ(transforms[i].position.x, velocities[i].linear.x);
+        }
+    });
+    
+    EXPECT_EQ(entity_total, COUNT);
+    EXPECT_GT(chunk_count, 1u);
+}
+
+TEST_F(ECSTest, SwapRemoveAcrossChunks) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 1000; ++i) {
+        const auto entity = world.create_entity();
+        world.add_component(entity, Name{.value = "entity_" + std::to_string(i)});
+        world.add_component(entity, Transform{.position = {static_cast<f32>(i), 0.0f, 0.0f}});
+        entities.push_back(entity);
+    }
+    
+    // Remove from the front so rows from the last chunk fill holes in the first
+    for (int i = 0; i < 500; i += 2) {
+        world.destroy_entity(entities[i]);
+    }
+    
+    for (int i = 1; i < 1000; i += (i < 500 ? 2 : 1)) {
+        const auto* name = world.get_component<Name>(entities[i]);
+        const auto* transform = world.get_component<Transform>(entities[i]);
+        ASSERT_NE(name, nullptr);
+        ASSERT_NE(transform, nullptr);
+        EXPECT_EQ(name->value, "entity_" + std::to_string(i));
+        EXPECT_EQ(transform->position.x, static_cast<f32>(i));
+    }
+    EXPECT_EQ(world.entity_count(), 750u);
+}
+
+// ========== Spawn Tests ==========
+
+TEST_F(ECSTest, SpawnWithComponents) {
+    const auto entity = world.spawn(
+        Transform{.position = {1.0f, 2.0f, 3.0f}},
+        Geometry::sphere(0.5f),
+        Name{.value = "Ball"}
+    );
+    
+    EXPECT_TRUE(world.is_alive(entity));
+    EXPECT_EQ(world.entity_count(), 1u);
+    EXPECT_EQ(world.archetype_count(), 1u);  // No intermediate archetypes
+    ASSERT_NE(world.get_component<Transform>(entity), nullptr);
+    EXPECT_EQ(world.get_component<Transform>(entity)->position.y, 2.0f);
+    EXPECT_EQ(world.get_component<Geometry>(entity)->params.x, 0.5f);
+    EXPECT_EQ(world.get_component<Name>(entity)->value, "Ball");
+    EXPECT_FALSE(world.has_component<Velocity>(entity));
+}
+
+TEST_F(ECSTest, SpawnBatchInitializesInPlace) {
+    constexpr std::size_t COUNT = 5000;
+    
+    const auto entities = world.spawn_batch<Transform, Velocity>(COUNT,
+        [](std::size_t i, Transform& transform, Velocity& velocity) {
+            transform.position.x = static_cast<f32>(i);
+            velocity.linear.x = static_cast<f32>(i) * 2.0f;
+        });
+    
+    ASSERT_EQ(entities.size(), COUNT);
+    EXPECT_EQ(world.entity_count(), COUNT);
+    EXPECT_EQ(world.archetype_count(), 1u);
+    
+    for (std::size_t i = 0; i < COUNT; i += 97) {
+        EXPECT_EQ(world.get_component<Transform>(entities[i])->position.x, static_cast<f32>(i));
+        EXPECT_EQ(world.get_component<Velocity>(entities[i])->linear.x, static_cast<f32>(i) * 2.0f);
+    }
+    
+    // Spawned entities behave like any other (migration, queries)
+    world.add_component(entities[0], Name{.value = "first"});
+    std::size_t count = 0;
+    world.each<Transform, Velocity>([&](Entity, const Transform&, const Velocity&) { count++; });
+    EXPECT_EQ(count, COUNT);
+}
+
+TEST_F(ECSTest, SpawnReusesDestroyedIds) {
+    const auto old_entity = world.spawn(Transform{});
+    world.destroy_entity(old_entity);
+    
+    const auto entities = world.spawn_batch<Transform>(2);
+    EXPECT_EQ(entities[0].id(), old_entity.id());
+    EXPECT_FALSE(world.is_alive(old_entity));
+    EXPECT_TRUE(world.is_alive(entities[0]));
+    EXPECT_TRUE(world.is_alive(entities[1]));
+}
+
+// ========== Component Registry Tests ==========
+
+TEST(ComponentRegistryTest, BuiltinsHaveFixedIds) {
+    EXPECT_EQ(component_id<Transform>(), 0u);
+    EXPECT_EQ(component_id<Geometry>(), 1u);
+    EXPECT_EQ(component_id<Material>(), 2u);
+    EXPECT_EQ(component_id<Velocity>(), 3u);
+    EXPECT_EQ(component_id<Name>(), 4u);
+    EXPECT_EQ(ComponentRegistry::instance().find("Transform"), 0u);
+}
+
+TEST(ComponentRegistryTest, UserTypesGetStableIds) {
+    auto& registry = ComponentRegistry::instance();
+    const auto paddle_id = registry.register_component<Paddle>("Paddle");
+    
+    EXPECT_GE(paddle_id, BUILTIN_COMPONENT_COUNT);
+    EXPECT_EQ(component_id<Paddle>(), paddle_id);
+    EXPECT_EQ(component_id<const Paddle&>(), paddle_id);
+    EXPECT_NE(component_id<Ball>(), paddle_id);
+    EXPECT_EQ(registry.find("Paddle"), paddle_id);
+    EXPECT_EQ(registry.name(paddle_id), "Paddle");
+    EXPECT_EQ(registry.info(paddle_id).size, sizeof(Paddle));
+}
+
+TEST(ComponentRegistryTest, RejectsDuplicateNames) {
+    auto& registry = ComponentRegistry::instance();
+    const auto paddle_id = registry.register_component<Paddle>("Paddle");
+    
+    EXPECT_EQ(registry.register_component<Ball>("Paddle"), INVALID_COMPONENT);
+    EXPECT_EQ(registry.find("Paddle"), paddle_id);
+    EXPECT_NE(registry.name(component_id<Ball>()), "Paddle");
+    EXPECT_EQ(registry.register_component<Paddle>("Paddle"), paddle_id);  // Same type again is fine
+}
+
+namespace {
+
+template<int N>
+struct Numbered {
+    i32 value{N};
+};
+
+template<int... N>
+auto register_numbered(std::integer_sequence<int, N...>) -> std::vector<u32> {
+    return {component_id<Numbered<N>>()...};
+}
+
+} // anonymous namespace
+
+TEST(ComponentRegistryTest, LookupsRaceWithRegistration) {
+    auto& registry = ComponentRegistry::instance();
+    std::atomic<bool> stop{false};
+    std::thread reader([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            EXPECT_EQ(registry.info(component_id<Transform>()).size, sizeof(Transform));
+        }
+    });
+    
+    // Enough types to span several record pages
+    const auto ids = register_numbered(std::make_integer_sequence<int, 150>{});
+    stop = true;
+    reader.join();
+    for (const u32 id : ids) {
+        EXPECT_EQ(registry.info(id).size, sizeof(i32));
+    }
+}
+
+TEST(ComponentSignatureTest, GrowsBeyond64Bits) {
+    ComponentSignature signature;
+    EXPECT_TRUE(signature.empty());
+    
+    signature.set(3).set(130);
+    EXPECT_TRUE(signature.test(3));
+    EXPECT_TRUE(signature.test(130));
+    EXPECT_FALSE(signature.test(64));
+    EXPECT_EQ(signature.count(), 2u);
+    
+    EXPECT_TRUE(signature.contains(ComponentSignature{}.set(130)));
+    EXPECT_FALSE(signature.contains(ComponentSignature{}.set(131)));
+    EXPECT_TRUE(signature.intersects(ComponentSignature{}.set(3).set(7)));
+    
+    // Normalized: clearing the high bit compares equal to a fresh signature
+    EXPECT_EQ(signature.without(130), ComponentSignature{}.set(3));
+    EXPECT_EQ(signature.without(130).hash(), ComponentSignature{}.set(3).hash());
+}
+
+TEST_F(ECSTest, UserComponentsWorkLikeBuiltins) {
+    const auto paddle = world.spawn(Transform{}, Paddle{.speed = 12.0f}, Collider{.layer = "paddles"});
+    const auto ball = world.create_entity();
+    world.add_component(ball, Ball{.radius = 0.25f});
+    world.add_component(ball, Collider{});
+    world.add_component(ball, Transform{});
+    
+    EXPECT_EQ(world.get_component<Paddle>(paddle)->speed, 12.0f);
+    EXPECT_EQ(world.get_component<Collider>(paddle)->layer, "paddles");
+    EXPECT_EQ(world.get_component<Ball>(ball)->radius, 0.25f);
+    EXPECT_FALSE(world.has_component<Ball>(paddle));
+    
+    int colliders = 0;
+    world.each<Transform, Collider>([&](Entity, const Transform&, const Collider&) { colliders++; });
+    EXPECT_EQ(colliders, 2);
+    
+    world.remove_component<Collider>(ball);
+    EXPECT_FALSE(world.has_component<Collider>(ball));
+    EXPECT_EQ(world.get_component<Ball>(ball)->radius, 0.25f);
+}
+
+TEST_F(ECSTest, MoreThan64ComponentTypes) {
+    const auto entity = world.create_entity();
+    
+    // 70 distinct marker types on one entity -> IDs and signature exceed 64 bits
+    [&]<u32... N>(std::integer_sequence<u32, N...>) {
+        (world.add_component(entity, Marker<N>{}), ...);
+    }(std::make_integer_sequence<u32, 70>{});
+    
+    EXPECT_GE(component_id<Marker<69>>(), 64u);
+    ASSERT_TRUE(world.has_component<Marker<69>>(entity));
+    EXPECT_EQ(world.get_component<Marker<0>>(entity)->value, 0u);
+    EXPECT_EQ(world.get_component<Marker<69>>(entity)->value, 69u);
+    
+    world.remove_component<Marker<35>>(entity);
+    EXPECT_FALSE(world.has_component<Marker<35>>(entity));
+    EXPECT_EQ(world.get_component<Marker<69>>(entity)->value, 69u);
+}
+
+// ========== Cached Query Tests ==========
+
+TEST_F(ECSTest, QueryMatchesIncrementally) {
+    Query<Transform> query{world};
+    
+    const auto e1 = world.spawn(Transform{});
+    EXPECT_EQ(query.size(), 1u);
+    EXPECT_EQ(query.archetypes().size(), 1u);
+    
+    // New archetypes created after the query was built are picked up
+    const auto e2 = world.spawn(Transform{}, Velocity{});
+    world.spawn(Velocity{});
+    EXPECT_EQ(query.size(), 2u);
+    EXPECT_EQ(query.archetypes().size(), 2u);
+    
+    int visited = 0;
+    query.each([&](Entity entity, Transform& transform) {
+        EXPECT_TRUE(entity == e1 || entity == e2);
+        transform.position.x = 5.0f;
+        visited++;
+    });
+    EXPECT_EQ(visited, 2);
+    EXPECT_EQ(world.get_component<Transform>(e2)->position.x, 5.0f);
+}
+
+TEST_F(ECSTest, QueryFilters) {
+    world.spawn(Transform{}, Velocity{.linear = {1.0f, 0.0f, 0.0f}});
+    world.spawn(Transform{}, Velocity{.linear = {2.0f, 0.0f, 0.0f}}, Name{.value = "named"});
+    world.spawn(Transform{}, Velocity{.linear = {3.0f, 0.0f, 0.0f}}, Material{});
+    world.spawn(Transform{});
+    
+    Query<const Velocity, With<Transform>, Without<Material>, Optional<Name>> query{world};
+    
+    f32 sum = 0.0f;
+    int named = 0;
+    query.each([&](Entity, const Velocity& velocity, Name* name) {
+        sum += velocity.linear.x;
+        if (name) {
+            EXPECT_EQ(name->value, "named");
+            named++;
+        }
+    });
+    EXPECT_EQ(sum, 3.0f);  // 1 + 2 (Material entity excluded, bare Transform lacks Velocity)
+    EXPECT_EQ(named, 1);
+    
+    std::size_t rows = 0;
+    query.each_chunk([&](std::span<const Entity> entities, std::span<const Velocity> velocities,
+                         std::span<Name> names) {
+        EXPECT_EQ(velocities.size(), entities.size());
+        EXPECT_TRUE(names.empty() || names.size() == entities.size());
+        rows += entities.size();
+    });
+    EXPECT_EQ(rows, 2u);
+}
+
+TEST_F(ECSTest, QueryRebuildsAfterClear) {
+    Query<Transform> query{world};
+    world.spawn(Transform{});
+    world.spawn(Transform{}, Name{});
+    EXPECT_EQ(query.size(), 2u);
+    
+    world.clear();
+    EXPECT_EQ(query.size(), 0u);
+    
+    world.spawn(Name{});
+    world.spawn(Transform{});
+    EXPECT_EQ(query.size(), 1u);
+    EXPECT_EQ(query.archetypes().size(), 1u);
+}
+
+// ========== Parallel Iteration Tests ==========
+
+TEST_F(ECSTest, ParEachVisitsEveryEntityOnce) {
+    auto jobs_result = JobSystem::create(4);
+    ASSERT_TRUE(jobs_result.has_value());
+    auto& jobs = **jobs_result;
+    
+    constexpr std::size_t COUNT = 20'000;
+    world.spawn_batch<Transform, Velocity>(COUNT, [](std::size_t i, Transform&, Velocity& velocity) {
+        velocity.linear = vec3(static_cast<f32>(i % 7), 1.0f, 0.0f);
+    });
+    world.spawn_batch<Transform>(100);  // Non-matching archetype
+    
+    world.par_each<Transform, Velocity>(jobs, [](Entity, Transform& transform, Velocity& velocity) {
+        transform.position += velocity.linear * 2.0f;
+    });
+    
+    // Read-only variant with a shared atomic accumulator
+    std::atomic<std::size_t> visited{0};
+    std::atomic<u64> y_sum{0};
+    std::as_const(world).par_each<Transform, Velocity>(jobs,
+        [&](Entity, const Transform& transform, const Velocity&) {
+            visited.fetch_add(1, std::memory_order_relaxed);
+            y_sum.fetch_add(static_cast<u64>(transform.position.y), std::memory_order_relaxed);
+        });
+    
+    EXPECT_EQ(visited.load(), COUNT);
+    EXPECT_EQ(y_sum.load(), COUNT * 2);
+    
+    world.each<Transform, Velocity>([](Entity, const Transform& transform, const Velocity& velocity) {
+        EXPECT_EQ(transform.position.x, velocity.linear.x * 2.0f);
+    });
+}
+
+TEST_F(ECSTest, ParEachChunkOnEmptyWorld) {
+    auto jobs_result = JobSystem::create(2);
+    ASSERT_TRUE(jobs_result.has_value());
+    
+    int calls = 0;
+    world.par_each_chunk<Transform>(**jobs_result, [&](std::span<const Entity>, std::span<Transform>) {
+        calls++;
+    });
+    EXPECT_EQ(calls, 0);
+}
+
+// ========== Column View Tests ==========
+
+TEST_F(ECSTest, EachChunkMixedConstSpans) {
+    world.spawn_batch<Transform, Velocity>(1000, [](std::size_t i, Transform&, Velocity& velocity) {
+        velocity.linear = vec3(1.0f, static_cast<f32>(i), 0.0f);
+    });
+    
+    world.each_chunk<Transform, const Velocity>([](std::span<const Entity> entities,
+                                                   std::span<Transform> transforms,
+                                                   std::span<const Velocity> velocities) {
+        ASSERT_EQ(transforms.size(), entities.size());
+        for (std::size_t i = 0; i < transforms.size(); ++i) {
+            transforms[i].position += velocities[i].linear * 0.5f;
+        }
+    });
+    
+    world.each<const Transform, Velocity>([](Entity, const Transform& transform, Velocity& velocity) {
+        EXPECT_EQ(transform.position.y, velocity.linear.y * 0.5f);
+    });
+}
+
+TEST_F(ECSTest, Vec3LanesGatherScatter) {
+    world.spawn_batch<Transform, Velocity>(700, [](std::size_t i, Transform& transform, Velocity& velocity) {
+        transform.position = vec3(static_cast<f32>(i), 0.0f, -1.0f);
+        velocity.linear = vec3(1.0f, 2.0f, 3.0f);
+    });
+    
+    Vec3Lanes positions;
+    Vec3Lanes velocities;
+    world.each_chunk<Transform, const Velocity>([&](std::span<const Entity>,
+                                                    std::span<Transform> transforms,
+                                                    std::span<const Velocity> linear) {
+        const auto position_field = field_view(transforms, &Transform::position);
+        EXPECT_EQ(position_field.stride(), sizeof(Transform));
+        
+        positions.gather(position_field);
+        velocities.gather(field_view(linear, &Velocity::linear));
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            positions.x()[i] += velocities.x()[i];
+            positions.y()[i] += velocities.y()[i];
+            positions.z()[i] += velocities.z()[i];
+        }
+        positions.scatter(position_field);
+    });
+    
+    int checked = 0;
+    world.each<Transform>([&](Entity, const Transform& transform) {
+        EXPECT_EQ(transform.position.y, 2.0f);
+        EXPECT_EQ(transform.position.z, 2.0f);
+        EXPECT_EQ(transform.scale.x, 1.0f);  // Neighbouring fields untouched
+        checked++;
+    });
+    EXPECT_EQ(checked, 700);
+}
+
+// ========== Change Detection Tests ==========
+
+namespace {
+
+template<typename T>
+auto changed_entities(const World& world, u32 since_tick) -> std::vector<Entity> {
+    std::vector<Entity> result;
+    world.each_changed<T>(since_tick, [&](Entity entity, const T&) { result.push_back(entity); });
+    return result;
+}
+
+} // anonymous namespace
+
+TEST_F(ECSTest, ChangeTicksTrackWrites) {
+    const auto entities = world.spawn_batch<Transform, Velocity>(1000);
+    EXPECT_EQ(changed_entities<Transform>(world, 0).size(), 1000u);  // Spawn counts as a write
+    
+    const u32 frame_start = world.change_tick();
+    world.advance_tick();
+    EXPECT_TRUE(changed_entities<Transform>(world, frame_start).empty());
+    
+    // Single mutable access marks one row
+    world.get_component<Transform>(entities[42])->position.x = 1.0f;
+    const auto changed = changed_entities<Transform>(world, frame_start);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], entities[42]);
+    EXPECT_TRUE(changed_entities<Velocity>(world, frame_start).empty());
+    
+    // Const access does not mark anything
+    std::as_const(world).each<Velocity>([](Entity, const Velocity&) {});
+    world.each_chunk<Transform, const Velocity>([](auto, std::span<Transform>, std::span<const Velocity>) {});
+    EXPECT_TRUE(changed_entities<Velocity>(world, frame_start).empty());
+    EXPECT_EQ(changed_entities<Transform>(world, frame_start).size(), 1000u);  // Writable span: whole column
+}
+
+TEST_F(ECSTest, ChangeTicksSurviveMigrationAndRemoval) {
+    const auto a = world.spawn(Transform{}, Velocity{});
+    const auto b = world.spawn(Transform{}, Velocity{});
+    const auto c = world.spawn(Transform{}, Velocity{});
+    
+    const u32 frame_start = world.change_tick();
+    world.advance_tick();
+    world.get_component<Velocity>(c)->linear.x = 1.0f;
+    
+    // c is swapped into a's row; its tick must move with it
+    world.destroy_entity(a);
+    auto changed = changed_entities<Velocity>(world, frame_start);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], c);
+    
+    // Migrating b keeps its (old) tick for carried components; the added one is new
+    world.add_component(b, Name{.value = "b"});
+    EXPECT_EQ(changed_entities<Velocity>(world, frame_start).size(), 1u);
+    EXPECT_EQ(changed_entities<Name>(world, frame_start).size(), 1u);
+}
+
+TEST_F(ECSTest, QueryWritesMarkChanges) {
+    world.spawn(Transform{}, Velocity{});
+    const u32 frame_start = world.change_tick();
+    world.advance_tick();
+    
+    Query<Transform, const Velocity> query{world};
+    query.each([](Entity, Transform&, const Velocity&) {});
+    EXPECT_EQ(changed_entities<Transform>(world, frame_start).size(), 1u);
+    EXPECT_TRUE(changed_entities<Velocity>(world, frame_start).empty());
+}
+
+TEST_F(ECSTest, CommandBufferDefersStructuralChanges) {
+    const auto a = world.spawn(Transform{}, Velocity{.linear = vec3(1.0f, 0.0f, 0.0f)});
+    const auto b = world.spawn(Transform{}, Velocity{});
+    const auto c = world.spawn(Transform{}, Velocity{});
+    
+    CommandBuffer commands;
+    world.each<Transform, Velocity>([&](Entity e, Transform&, Velocity& v) {
+        if (e == a) {
+            commands.destroy(e);
+            commands.spawn(Transform{}, Name{.value = "debris"});
+        } else if (e == b) {
+            commands.add(e, Name{.value = "b"});
+            commands.remove<Velocity>(e);
+        } else {
+            commands.add(e, Velocity{.linear = v.linear + vec3(0.0f, 2.0f, 0.0f)});  // Replace in place
+        }
+    });
+    
+    // Nothing happened yet
+    EXPECT_EQ(world.entity_count(), 3u);
+    EXPECT_EQ(commands.size(), 7u);
+    
+    commands.apply(world);
+    EXPECT_TRUE(commands.empty());
+    EXPECT_EQ(world.entity_count(), 3u);
+    EXPECT_FALSE(world.is_alive(a));
+    
+    EXPECT_FALSE(world.has_component<Velocity>(b));
+    ASSERT_TRUE(world.has_component<Name>(b));
+    EXPECT_EQ(world.get_component<Name>(b)->value, "b");
+    EXPECT_FLOAT_EQ(world.get_component<Velocity>(c)->linear.y, 2.0f);
+    
+    std::vector<std::string> names;
+    world.each<Name>([&](Entity, Name& name) { names.push_back(name.value); });
+    std::ranges::sort(names);
+    EXPECT_EQ(names, (std::vector<std::string>{"b", "debris"}));
+}
+
+TEST_F(ECSTest, CommandBufferSkipsDeadEntities) {
+    const auto e = world.spawn(Transform{});
+    
+    CommandBuffer commands;
+    commands.destroy(e);
+    commands.add(e, Collider{.layer = "a string long enough to live on the heap"});
+    commands.remove<Transform>(e);
+    commands.destroy(e);
+    commands.apply(world);  // Only the first destroy takes effect; the payload is destroyed
+    
+    EXPECT_FALSE(world.is_alive(e));
+    EXPECT_EQ(world.entity_count(), 0u);
+}
+
+TEST_F(ECSTest, CommandBufferClearDestroysPayloads) {
+    CommandBuffer commands;
+    for (int i = 0; i < 2000; ++i) {  // Spans several arena blocks
+        commands.spawn(Collider{.layer = "a string long enough to live on the heap"}, Name{.value = std::to_string(i)});
+    }
+    commands.clear();  // Must not leak (checked under ASan)
+    EXPECT_TRUE(commands.empty());
+    
+    commands.spawn(Name{.value = "reused"});
+    commands.apply(world);
+    EXPECT_EQ(world.entity_count(), 1u);
+}
+
+TEST_F(ECSTest, ThreadCommandBuffersRecordFromParEach) {
+    world.spawn_batch<Transform, Velocity>(5000, [](std::size_t i, Transform&, Velocity& velocity) {
+        velocity.linear.x = static_cast<f32>(i);
+    });
+    
+    auto jobs_result = JobSystem::create(4);
+    ASSERT_TRUE(jobs_result.has_value());
+    auto& jobs = **jobs_result;
+    
+    ThreadCommandBuffers commands;
+    world.par_each<const Velocity>(jobs, [&](Entity e, const Velocity& v) {
+        auto& local = commands.local();
+        if (static_cast<u32>(v.linear.x) % 2 == 0) {
+            local.destroy(e);
+        } else {
+            local.spawn(Name{.value = "spawned"});
+        }
+    });
+    commands.apply(world);
+    
+    std::size_t velocities = 0;
+    std::size_t names = 0;
+    world.each<Velocity>([&](Entity, Velocity&) { ++velocities; });
+    world.each<Name>([&](Entity, Name&) { ++names; });
+    EXPECT_EQ(velocities, 2500u);
+    EXPECT_EQ(names, 2500u);
+    EXPECT_EQ(world.entity_count(), 5000u);
+}
+
+TEST_F(ECSTest, ThreadCommandBuffersKeepInstancesApart) {
+    // One thread alternating between instances gets each instance's own buffer
+    ThreadCommandBuffers first;
+    ThreadCommandBuffers second;
+    first.local().spawn(Name{.value = "first"});
+    second.local().spawn(Name{.value = "second"});
+    first.local().spawn(Name{.value = "first"});
+    EXPECT_NE(&first.local(), &second.local());
+    
+    first.apply(world);
+    EXPECT_EQ(world.entity_count(), 2u);
+    second.apply(world);
+    EXPECT_EQ(world.entity_count(), 3u);
+    
+    // A new instance (possibly at a recycled address) starts empty
+    for (int i = 0; i < 3; ++i) {
+        auto commands = std::make_unique<ThreadCommandBuffers>();
+        EXPECT_TRUE(commands->local().empty());
+        commands->local().spawn(Name{});
+    }
+    EXPECT_EQ(world.entity_count(), 3u);
+}
+
+TEST(ScheduleTest, ConflictingSystemsFormWaves) {
+    Schedule schedule;
+    const auto integrate = schedule.add_system("integrate", SystemAccess{}.read<Velocity>().write<Transform>(), {});
+    const auto labels = schedule.add_system("labels", SystemAccess{}.read<Name>(), {});
+    const auto damping = schedule.add_system("damping", SystemAccess{}.write<Velocity>(), {});
+    const auto render = schedule.add_system("render", SystemAccess{}.read<Transform, Name>(), {});
+    const auto cleanup = schedule.add_system("cleanup", SystemAccess{}.exclusive(), {});
+    
+    const auto waves = schedule.waves();
+    ASSERT_EQ(waves.size(), 3u);
+    EXPECT_EQ(waves[0], (std::vector<u32>{integrate, labels}));
+    EXPECT_EQ(waves[1], (std::vector<u32>{damping, render}));  // Readers of Transform wait; Name readers share
+    EXPECT_EQ(waves[2], (std::vector<u32>{cleanup}));
+    
+    EXPECT_TRUE(schedule.dependencies(labels).empty());
+    const auto damping_deps = schedule.dependencies(damping);
+    EXPECT_EQ(std::vector<u32>(damping_deps.begin(), damping_deps.end()), std::vector<u32>{integrate});
+    EXPECT_EQ(schedule.dependencies(cleanup).size(), 4u);
+    EXPECT_EQ(schedule.system_name(render), "render");
+}
+
+TEST_F(ECSTest, ScheduleRunsSystemsInConflictOrder) {
+    world.spawn_batch<Transform, Velocity>(1000, [](std::size_t, Transform&, Velocity& velocity) {
+        velocity.linear = vec3(1.0f, 0.0f, 0.0f);
+    });
+    world.spawn_batch<Name>(10);
+    
+    auto jobs_result = JobSystem::create(4);
+    ASSERT_TRUE(jobs_result.has_value());
+    auto& jobs = **jobs_result;
+    
+    std::atomic<u32> named{0};
+    ThreadCommandBuffers commands;
+    
+    Schedule schedule;
+    schedule.add_system("integrate", SystemAccess{}.read<Velocity>().write<Transform>(), [](World& w) {
+        w.each<Transform, const Velocity>([](Entity, Transform& t, const Velocity& v) { t.position += v.linear; });
+    });
+    schedule.add_system("double", SystemAccess{}.write<Velocity>(), [](World& w) {
+        w.each<Velocity>([](Entity, Velocity& v) { v.linear = v.linear * 2.0f; });
+    });
+    schedule.add_system("count_names", SystemAccess{}.read<Name>(), [&](World& w) {
+        w.each<const Name>([&](Entity, const Name&) { named.fetch_add(1, std::memory_order_relaxed); });
+    });
+    schedule.add_system("spawn_marker", SystemAccess{}.read<Transform>(), [&](World&) {
+        commands.local().spawn(Name{.value = "marker"});
+    });
+    
+    for (int frame = 0; frame < 3; ++frame) {
+        schedule.run(world, jobs);
+        commands.apply(world);
+    }
+    
+    // integrate always sees the velocity of the previous frame's doubling: 1 + 2 + 4
+    world.each<Transform>([](Entity, Transform& t) { EXPECT_FLOAT_EQ(t.position.x, 7.0f); });
+    EXPECT_EQ(named.load(), 10u + 11u + 12u);
+    EXPECT_EQ(world.entity_count(), 1013u);
+}
+
+TEST_F(ECSTest, SparseComponentsAttachWithoutMigration) {
+    const auto e = world.spawn(Transform{}, Velocity{});
+    const auto archetypes = world.archetype_count();
+    
+    for (int frame = 0; frame < 100; ++frame) {
+        world.add_component(e, Hit{.damage = static_cast<f32>(frame)});
+        ASSERT_TRUE(world.has_component<Hit>(e));
+        EXPECT_FLOAT_EQ(world.get_component<Hit>(e)->damage, static_cast<f32>(frame));
+        world.remove_component<Hit>(e);
+        EXPECT_FALSE(world.has_component<Hit>(e));
+    }
+    
+    EXPECT_EQ(world.archetype_count(), archetypes);
+    EXPECT_EQ(world.archetype(0).size(), 1u);
+    EXPECT_TRUE(world.has_component<Velocity>(e));
+    
+    // Destroying the entity drops its sparse components; the ID's next owner starts clean
+    world.add_component(e, Selected{});
+    world.destroy_entity(e);
+    const auto reused = world.create_entity();
+    ASSERT_EQ(reused.id(), e.id());
+    EXPECT_FALSE(world.has_component<Selected>(reused));
+    EXPECT_EQ(world.get_component<Selected>(e), nullptr);
+}
+
+TEST_F(ECSTest, EachCombinesTableAndSparseComponents) {
+    const auto entities = world.spawn_batch<Transform>(100);
+    for (std::size_t i = 0; i < entities.size(); i += 10) {
+        world.add_component(entities[i], Hit{.damage = 1.0f});
+    }
+    const auto sparse_only = world.spawn(Hit{.damage = 5.0f});  // No archetype at all
+    
+    std::size_t visited = 0;
+    world.each<Transform, Hit>([&](Entity e, Transform& t, Hit& hit) {
+        t.position.x = hit.damage;
+        hit.damage += 1.0f;
+        ++visited;
+    });
+    EXPECT_EQ(visited, 10u);
+    EXPECT_FLOAT_EQ(world.get_component<Transform>(entities[10])->position.x, 1.0f);
+    EXPECT_FLOAT_EQ(world.get_component<Transform>(entities[11])->position.x, 0.0f);
+    
+    f32 total = 0.0f;
+    std::as_const(world).each<Hit>([&](Entity, const Hit& hit) { total += hit.damage; });
+    EXPECT_FLOAT_EQ(total, 10 * 2.0f + 5.0f);
+    EXPECT_TRUE(world.has_component<Hit>(sparse_only));
+    
+    auto jobs_result = JobSystem::create(4);
+    ASSERT_TRUE(jobs_result.has_value());
+    std::atomic<std::size_t> parallel_visited{0};
+    world.par_each<const Transform, Hit>(**jobs_result, [&](Entity, const Transform&, Hit& hit) {
+        hit.damage = 0.0f;
+        parallel_visited.fetch_add(1, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(parallel_visited.load(), 10u);
+    EXPECT_FLOAT_EQ(world.get_component<Hit>(entities[0])->damage, 0.0f);
+}
+
+TEST_F(ECSTest, QueryFiltersOnSparseComponents) {
+    const auto entities = world.spawn_batch<Transform, Velocity>(50);
+    for (std::size_t i = 0; i < 5; ++i) {
+        world.add_component(entities[i], Hit{.damage = 2.0f});
+    }
+    world.add_component(entities[0], Selected{.label = "first"});
+    
+    Query<const Transform, Without<Hit>> untouched{world};
+    EXPECT_EQ(untouched.size(), 45u);
+    
+    Query<Transform, const Hit, Optional<Selected>> hit{world};
+    std::size_t selected = 0;
+    std::size_t visited = 0;
+    hit.each([&](Entity, Transform& t, const Hit& h, Selected* s) {
+        t.position.y = h.damage;
+        selected += s != nullptr;
+        ++visited;
+    });
+    EXPECT_EQ(visited, 5u);
+    EXPECT_EQ(selected, 1u);
+    EXPECT_FLOAT_EQ(world.get_component<Transform>(entities[4])->position.y, 2.0f);
+    
+    Query<With<Velocity>, With<Hit>, Without<Selected>> filtered{world};
+    EXPECT_EQ(filtered.size(), 4u);
+}
+
+TEST_F(ECSTest, SparseComponentsThroughCommandBuffer) {
+    const auto e = world.spawn(Transform{});
+    
+    CommandBuffer commands;
+    commands.add(e, Selected{.label = "picked by the editor cursor this frame"});
+    commands.spawn(Transform{}, Hit{.damage = 3.0f});
+    commands.spawn(Selected{});
+    commands.apply(world);
+    
+    ASSERT_TRUE(world.has_component<Selected>(e));
+    EXPECT_EQ(world.get_component<Selected>(e)->label, "picked by the editor cursor this frame");
+    
+    std::size_t hits = 0;
+    world.each<Transform, Hit>([&](Entity, Transform&, Hit& h) { hits += h.damage == 3.0f; });
+    EXPECT_EQ(hits, 1u);
+    
+    std::size_t selections = 0;
+    world.each<Selected>([&](Entity, Selected&) { ++selections; });
+    EXPECT_EQ(selections, 2u);
+    
+    commands.remove<Selected>(e);
+    commands.apply(world);
+    EXPECT_FALSE(world.has_component<Selected>(e));
+}
+
+TEST_F(ECSTest, SparseChangeTicks) {
+    const auto a = world.spawn(Transform{}, Hit{});
+    const auto b = world.spawn(Transform{}, Hit{});
+    
+    const u32 frame_start = world.change_tick();
+    world.advance_tick();
+    world.get_component<Hit>(b)->damage = 4.0f;
+    
+    std::vector<Entity> changed;
+    world.each_changed<Hit>(frame_start, [&](Entity e, const Hit&) { changed.push_back(e); });
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], b);
+    EXPECT_NE(changed[0], a);
+}
+
+TEST_F(ECSTest, TagComponentsHaveNoColumn) {
+    static_assert(is_tag_component_v<Static>);
+    static_assert(!is_tag_component_v<Transform>);
+    
+    const auto e = world.spawn(Transform{.position = vec3(1.0f, 2.0f, 3.0f)}, Static{});
+    ASSERT_EQ(world.archetype_count(), 1u);
+    const auto& archetype = world.archetype(0);
+    EXPECT_EQ(archetype.columns().size(), 1u);  // Transform only
+    EXPECT_TRUE(archetype.signature().test(component_id<Static>()));
+    EXPECT_FALSE(archetype.has_component_array(component_id<Static>()));
+    EXPECT_TRUE(world.has_component<Static>(e));
+    
+    // Adding a tag migrates (new signature) but copies only real columns
+    world.add_component(e, Emissive{});
+    world.add_component(e, Emissive{});  // Already tagged: no-op
+    EXPECT_EQ(world.archetype_count(), 2u);
+    EXPECT_TRUE(world.has_component<Emissive>(e));
+    EXPECT_EQ(world.get_component<Transform>(e)->position, vec3(1.0f, 2.0f, 3.0f));
+    
+    world.remove_component<Static>(e);
+    EXPECT_FALSE(world.has_component<Static>(e));
+    EXPECT_TRUE(world.has_component<Emissive>(e));
+    
+    // Tag-only entity lives in a column-less archetype
+    const auto marker = world.spawn(Static{});
+    EXPECT_TRUE(world.has_component<Static>(marker));
+    world.destroy_entity(marker);
+    EXPECT_EQ(world.entity_count(), 1u);
+}
+
+TEST_F(ECSTest, QueryFiltersOnTags) {
+    world.spawn_batch<Transform, Static>(30, [](std::size_t i, Transform& t, Static&) {
+        t.position.x = static_cast<f32>(i);
+    });
+    world.spawn_batch<Transform, Static, Emissive>(20);
+    world.spawn_batch<Transform>(10);
+    
+    Query<const Transform, With<Static>, Without<Emissive>> static_only{world};
+    EXPECT_EQ(static_only.size(), 30u);
+    
+    Query<const Transform, With<Emissive>> emissive{world};
+    EXPECT_EQ(emissive.size(), 20u);
+    
+    f32 sum = 0.0f;
+    static_only.each([&](Entity, const Transform& t) { sum += t.position.x; });
+    EXPECT_FLOAT_EQ(sum, 29.0f * 30.0f / 2.0f);
+    
+    // Deferred tag changes
+    CommandBuffer commands;
+    world.each<Transform>([&](Entity e, Transform& t) {
+        if (t.position.x >= 25.0f) {
+            commands.add(e, Emissive{});
+        }
+    });
+    commands.spawn(Transform{}, Emissive{});
+    commands.apply(world);
+    EXPECT_EQ(static_only.size(), 25u);
+    EXPECT_EQ(emissive.size(), 26u);
+}
+
+// ========== Hierarchy Tests ==========
+
+TEST_F(ECSTest, HierarchyPropagatesWorldTransforms) {
+    const auto root = world.spawn(Transform{.position = vec3(1.0f, 0.0f, 0.0f)}, WorldTransform{});
+    const auto child = world.spawn(Transform{.position = vec3(0.0f, 2.0f, 0.0f)});
+    const auto grandchild = world.spawn(Transform{.position = vec3(0.0f, 0.0f, 3.0f)});
+    ASSERT_TRUE(set_parent(world, child, root));
+    ASSERT_TRUE(set_parent(world, grandchild, child));
+    EXPECT_FALSE(set_parent(world, root, grandchild));  // Would create a cycle
+    EXPECT_FALSE(set_parent(world, root, root));
+    
+    TransformHierarchy hierarchy;
+    hierarchy.propagate(world);
+    ASSERT_EQ(hierarchy.levels().size(), 3u);
+    EXPECT_EQ(hierarchy.last_updated(), 3u);
+    EXPECT_EQ(world.get_component<WorldTransform>(grandchild)->position(), vec3(1.0f, 2.0f, 3.0f));
+    
+    // Re-parent: grandchild now hangs directly off the root
+    world.advance_tick();
+    ASSERT_TRUE(set_parent(world, grandchild, root));
+    EXPECT_TRUE(std::as_const(world).get_component<Children>(child)->entities.empty());
+    hierarchy.propagate(world);
+    EXPECT_EQ(hierarchy.levels().size(), 2u);
+    EXPECT_EQ(world.get_component<WorldTransform>(grandchild)->position(), vec3(1.0f, 0.0f, 3.0f));
+    
+    // Detached: local becomes world
+    world.advance_tick();
+    remove_parent(world, grandchild);
+    hierarchy.propagate(world);
+    EXPECT_EQ(world.get_component<WorldTransform>(grandchild)->position(), vec3(0.0f, 0.0f, 3.0f));
+    
+    destroy_recursive(world, root);
+    EXPECT_FALSE(world.is_alive(root));
+    EXPECT_FALSE(world.is_alive(child));
+    EXPECT_TRUE(world.is_alive(grandchild));
+}
+
+TEST_F(ECSTest, HierarchySkipsCleanSubtrees) {
+    std::vector<Entity> roots;
+    for (int r = 0; r < 4; ++r) {
+        const auto root = world.spawn(Transform{.position = vec3(static_cast<f32>(r), 0.0f, 0.0f)}, WorldTransform{});
+        for (int c = 0; c < 3; ++c) {
+            set_parent(world, world.spawn(Transform{.position = vec3(0.0f, 1.0f, 0.0f)}), root);
+        }
+        roots.push_back(root);
+    }
+    
+    TransformHierarchy hierarchy;
+    hierarchy.propagate(world);
+    EXPECT_EQ(hierarchy.last_updated(), 16u);
+    
+    // Nothing written: nothing recomputed
+    world.advance_tick();
+    hierarchy.propagate(world);
+    EXPECT_EQ(hierarchy.last_updated(), 0u);
+    
+    // Moving one root recomputes only that root and its children
+    world.advance_tick();
+    world.get_component<Transform>(roots[2])->position.z = 5.0f;
+    hierarchy.propagate(world);
+    EXPECT_EQ(hierarchy.last_updated(), 4u);
+    for (const auto child : std::as_const(world).get_component<Children>(roots[2])->entities) {
+        EXPECT_EQ(world.get_component<WorldTransform>(child)->position(), vec3(2.0f, 1.0f, 5.0f));
+    }
+}
+
+TEST_F(ECSTest, HierarchySeesWritesAfterPropagate) {
+    const auto root = world.spawn(Transform{}, WorldTransform{});
+    const auto child = world.spawn(Transform{.position = vec3(0.0f, 2.0f, 0.0f)});
+    ASSERT_TRUE(set_parent(world, child, root));
+    
+    TransformHierarchy hierarchy;
+    hierarchy.propagate(world);
+    
+    // Written after propagate() within the same frame
+    world.get_component<Transform>(root)->position.y = 10.0f;
+    world.advance_tick();
+    hierarchy.propagate(world);
+    EXPECT_EQ(hierarchy.last_updated(), 2u);
+    hierarchy.propagate(world);
+    EXPECT_EQ(hierarchy.last_updated(), 0u);
+    EXPECT_EQ(std::as_const(world).get_component<WorldTransform>(child)->position(), vec3(0.0f, 12.0f, 0.0f));
+}
+
+TEST_F(ECSTest, HierarchyParallelLevels) {
+    auto jobs_result = JobSystem::create(4);
+    ASSERT_TRUE(jobs_result.has_value());
+    auto& jobs = **jobs_result;
+    
+    const auto root = world.spawn(Transform{.position = vec3(0.0f, 10.0f, 0.0f)}, WorldTransform{});
+    std::vector<Entity> leaves;
+    for (int i = 0; i < 1000; ++i) {
+        const auto child = world.spawn(Transform{.position = vec3(static_cast<f32>(i), 0.0f, 0.0f)});
+        set_parent(world, child, root);
+        const auto leaf = world.spawn(Transform{.position = vec3(0.0f, 0.0f, 1.0f)});
+        set_parent(world, leaf, child);
+        leaves.push_back(leaf);
+    }
+    
+    TransformHierarchy hierarchy;
+    hierarchy.propagate(world, jobs);
+    ASSERT_EQ(hierarchy.levels().size(), 3u);
+    EXPECT_EQ(hierarchy.levels()[1].size(), 1000u);
+    for (std::size_t i = 0; i < leaves.size(); ++i) {
+        EXPECT_EQ(world.get_component<WorldTransform>(leaves[i])->position(),
+                  vec3(static_cast<f32>(i), 10.0f, 1.0f));
+    }
+    
+    // Whole-column write through each() marks every child dirty
+    world.advance_tick();
+    world.each<Transform>([](Entity, Transform& t) { t.scale = vec3(2.0f); });
+    hierarchy.propagate(world, jobs);
+    EXPECT_EQ(hierarchy.last_updated(), 2001u);
+    EXPECT_EQ(world.get_component<WorldTransform>(leaves[3])->position(), vec3(6.0f, 10.0f, 4.0f));
+    
+    // Parallel levels stamp exactly the rows they wrote
+    world.advance_tick();
+    const u32 since = world.change_tick();
+    world.advance_tick();
+    for (std::size_t i = 0; i < 300; ++i) {
+        const Entity child = std::as_const(world).get_component<Parent>(leaves[i])->entity;
+        world.get_component<Transform>(child)->position.y = 1.0f;
+    }
+    hierarchy.propagate(world, jobs);
+    EXPECT_EQ(hierarchy.last_updated(), 600u);
+    std::size_t changed = 0;
+    world.each_changed<WorldTransform>(since, [&](Entity, const WorldTransform&) { ++changed; });
+    EXPECT_EQ(changed, 600u);
+    EXPECT_EQ(std::as_const(world).get_component<WorldTransform>(leaves[0])->position(), vec3(0.0f, 12.0f, 4.0f));
+}
+
+// ========== Relationship Tests ==========
+
+TEST_F(ECSTest, RelationPairsIndexBothDirections) {
+    const auto car = world.spawn(Transform{});
+    const auto truck = world.spawn(Transform{});
+    std::vector<Entity> wheels;
+    for (int i = 0; i < 4; ++i) {
+        wheels.push_back(world.spawn(Transform{}));
+        EXPECT_TRUE(world.add_pair<ChildOf>(wheels.back(), car));
+    }
+    EXPECT_FALSE(world.add_pair<ChildOf>(wheels[0], car));  // Already present
+    
+    EXPECT_EQ(world.sources<ChildOf>(car).size(), 4u);
+    EXPECT_TRUE(world.sources<ChildOf>(truck).empty());
+    EXPECT_EQ(world.target<ChildOf>(wheels[2]), car);
+    EXPECT_TRUE(world.has_pair<ChildOf>(wheels[2], car));
+    EXPECT_EQ(world.archetype_count(), 1u);  // Pairs never migrate entities
+    
+    // Exclusive: re-targeting moves the pair
+    EXPECT_TRUE(world.add_pair<ChildOf>(wheels[3], truck));
+    EXPECT_EQ(world.target<ChildOf>(wheels[3]), truck);
+    EXPECT_EQ(world.sources<ChildOf>(car).size(), 3u);
+    EXPECT_EQ(world.sources<ChildOf>(truck).size(), 1u);
+    EXPECT_EQ(world.pair_count<ChildOf>(), 4u);
+    
+    // Non-exclusive: many targets per source
+    world.add_pair<CollidesWith>(wheels[0], wheels[1]);
+    world.add_pair<CollidesWith>(wheels[0], truck);
+    EXPECT_EQ(world.targets<CollidesWith>(wheels[0]).size(), 2u);
+    EXPECT_FALSE(world.has_pair<ChildOf>(wheels[0], wheels[1]));  // Relations are separate
+    
+    EXPECT_TRUE(world.remove_pair<ChildOf>(wheels[1], car));
+    EXPECT_FALSE(world.remove_pair<ChildOf>(wheels[1], car));
+    EXPECT_EQ(world.target<ChildOf>(wheels[1]), NULL_ENTITY);
+    EXPECT_EQ(world.sources<ChildOf>(car).size(), 2u);
+}
+
+TEST_F(ECSTest, DestroyingEntityDropsItsPairs) {
+    const auto parent = world.spawn(Transform{});
+    const auto a = world.spawn(Transform{});
+    const auto b = world.spawn(Transform{});
+    world.add_pair<ChildOf>(a, parent);
+    world.add_pair<ChildOf>(b, parent);
+    world.add_pair<CollidesWith>(a, b);
+    world.add_pair<CollidesWith>(b, a);
+    world.add_pair<CollidesWith>(a, a);
+    
+    // As target
+    world.destroy_entity(parent);
+    EXPECT_EQ(world.pair_count<ChildOf>(), 0u);
+    EXPECT_EQ(world.target<ChildOf>(a), NULL_ENTITY);
+    
+    // As source and target at once (including a self-pair)
+    world.destroy_entity(a);
+    EXPECT_EQ(world.pair_count<CollidesWith>(), 0u);
+    EXPECT_TRUE(world.targets<CollidesWith>(b).empty());
+    EXPECT_TRUE(world.sources<CollidesWith>(b).empty());
+    
+    // Stale handles cannot form pairs; a recycled ID starts clean
+    EXPECT_FALSE(world.add_pair<CollidesWith>(a, b));
+    const auto recycled = world.spawn(Transform{});
+    EXPECT_TRUE(world.sources<CollidesWith>(recycled).empty());
+    
+    world.add_pair<ChildOf>(b, recycled);
+    world.clear();
+    EXPECT_EQ(world.pair_count<ChildOf>(), 0u);
+}
+
+// ========== Snapshot Tests ==========
+
+TEST_F(ECSTest, SnapshotRestoresWorldState) {
+    const auto a = world.spawn(Transform{.position = vec3(1.0f, 0.0f, 0.0f)}, Name{"a"});
+    const auto b = world.spawn(Transform{.position = vec3(2.0f, 0.0f, 0.0f)}, Velocity{});
+    world.add_component(a, Hit{.damage = 5.0f});
+    world.add_pair<ChildOf>(b, a);
+    
+    auto snapshot = world.snapshot();
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(snapshot->entity_count(), 2u);
+    
+    // Diverge: move, rename, destroy, spawn, toggle
+    world.get_component<Transform>(a)->position.x = 100.0f;
+    world.get_component<Name>(a)->value = "changed";
+    world.remove_component<Hit>(a);
+    world.destroy_entity(b);
+    const auto c = world.spawn(Transform{}, Static{});
+    
+    world.restore(*snapshot);
+    EXPECT_EQ(world.entity_count(), 2u);
+    EXPECT_TRUE(world.is_alive(a));
+    EXPECT_TRUE(world.is_alive(b));
+    EXPECT_FALSE(world.is_alive(c));
+    EXPECT_FLOAT_EQ(world.get_component<Transform>(a)->position.x, 1.0f);
+    EXPECT_EQ(world.get_component<Name>(a)->value, "a");
+    EXPECT_FLOAT_EQ(world.get_component<Hit>(a)->damage, 5.0f);
+    EXPECT_TRUE(world.has_component<Velocity>(b));
+    EXPECT_EQ(world.target<ChildOf>(b), a);
+    
+    // Restored rows count as written, and the world stays usable
+    std::size_t changed = 0;
+    world.each_changed<Transform>(snapshot->tick(), [&](Entity, const Transform&) { ++changed; });
+    EXPECT_EQ(changed, 2u);
+    const auto d = world.spawn(Transform{}, Name{"d"});
+    EXPECT_EQ(world.get_component<Name>(d)->value, "d");
+    EXPECT_NE(d, b);
+}
+
+TEST_F(ECSTest, SnapshotSharesUnwrittenPages) {
+    const auto movers = world.spawn_batch<Transform>(2000);
+    world.spawn_batch<Velocity>(100);
+    
+    auto first = world.snapshot();
+    ASSERT_TRUE(first.has_value());
+    const std::size_t pages = first->page_count();
+    EXPECT_GT(pages, 2u);
+    EXPECT_EQ(first->shared_page_count(), 0u);
+    
+    // Nothing written: every page shared
+    auto second = world.snapshot();
+    EXPECT_EQ(second->shared_page_count(), pages);
+    
+    // One write: only that chunk is copied
+    world.get_component<Transform>(movers[5])->position.y = 7.0f;
+    auto third = world.snapshot();
+    EXPECT_EQ(third->page_count(), pages);
+    EXPECT_EQ(third->shared_page_count(), pages - 1);
+    
+    // Older snapshot still sees the old value (pages are immutable)
+    World render_world;
+    render_world.restore(*first);
+    EXPECT_FLOAT_EQ(render_world.get_component<Transform>(movers[5])->position.y, 0.0f);
+    render_world.restore(*third);
+    EXPECT_FLOAT_EQ(render_world.get_component<Transform>(movers[5])->position.y, 7.0f);
+    EXPECT_EQ(render_world.entity_count(), 2100u);
+    
+    // Structural change without a value write still invalidates the page
+    world.destroy_entity(movers[0]);
+    auto fourth = world.snapshot();
+    EXPECT_LT(fourth->shared_page_count(), pages);
+    render_world.restore(*fourth);
+    EXPECT_FALSE(render_world.is_alive(movers[0]));
+    EXPECT_EQ(render_world.entity_count(), 2099u);
+}
+
+TEST_F(ECSTest, SnapshotRejectsMoveOnlyComponents) {
+    const auto e = world.spawn(Transform{});
+    world.add_component(e, Handle{std::make_unique<int>(3)});
+    
+    const auto snapshot = world.snapshot();
+    ASSERT_FALSE(snapshot.has_value());
+    EXPECT_EQ(snapshot.error().code, ErrorCode::SCENE_COMPONENT_NOT_COPYABLE);
+    
+    world.restore(WorldSnapshot{});
+    EXPECT_EQ(world.entity_count(), 0u);
+}
+
+// ========== Compaction Tests ==========
+
+TEST_F(ECSTest, CompactDropsEmptyArchetypes) {
+    const auto kept = world.spawn_batch<Transform, Velocity>(50);
+    const auto doomed = world.spawn_batch<Transform, Name>(50);
+    const auto tagged = world.spawn_batch<Transform, Static>(10);
+    for (const auto e : doomed) {
+        world.destroy_entity(e);
+    }
+    world.add_component(kept[0], Name{"survivor"});  // Transform+Velocity+Name archetype
+    
+    Query<const Transform, With<Static>> statics{world};
+    EXPECT_EQ(statics.size(), 10u);
+    const std::size_t before = world.archetype_count();
+    const u64 epoch = world.archetype_epoch();
+    
+    EXPECT_TRUE(world.compact(std::chrono::microseconds::max()));
+    EXPECT_EQ(world.archetype_count(), before - 1);
+    EXPECT_NE(world.archetype_epoch(), epoch);
+    
+    // Every survivor still resolves, cached queries rebuild, edges still work
+    EXPECT_EQ(statics.size(), 10u);
+    EXPECT_EQ(world.get_component<Name>(kept[0])->value, "survivor");
+    for (const auto e : tagged) {
+        EXPECT_TRUE(world.has_component<Static>(e));
+    }
+    world.add_component(kept[1], Name{"late"});
+    world.remove_component<Velocity>(kept[1]);
+    world.add_component(tagged[0], Name{"moved"});
+    EXPECT_EQ(world.get_component<Name>(kept[1])->value, "late");
+    EXPECT_EQ(world.get_component<Name>(tagged[0])->value, "moved");
+    std::size_t count = 0;
+    world.each<Transform>([&](Entity, const Transform&) { ++count; });
+    EXPECT_EQ(count, 60u);
+    
+    // Freed IDs are handed out lowest first after a pass
+    const auto reused = world.create_entity();
+    EXPECT_EQ(reused.id(), doomed.front().id());
+}
+
+TEST_F(ECSTest, CompactReordersRowsByKey) {
+    const auto entities = world.spawn_batch<Transform, Name>(600, [](std::size_t i, Transform& t, Name& n) {
+        t.position.x = static_cast<f32>(600 - i);
+        n.value = std::to_string(600 - i);
+    });
+    
+    const auto by_x = [this](Entity e) {
+        return static_cast<u64>(std::as_const(world).get_component<Transform>(e)->position.x);
+    };
+    while (!world.compact(std::chrono::microseconds::max(), by_x)) {
+    }
+    
+    // Iteration order now follows the key, components stayed with their entity
+    std::vector<f32> order;
+    world.each<Transform, Name>([&](Entity, const Transform& t, const Name& n) {
+        order.push_back(t.position.x);
+        EXPECT_EQ(n.value, std::to_string(static_cast<int>(t.position.x)));
+    });
+    EXPECT_TRUE(std::ranges::is_sorted(order));
+    EXPECT_EQ(order.size(), 600u);
+    EXPECT_FLOAT_EQ(world.get_component<Transform>(entities[0])->position.x, 600.0f);
+    EXPECT_FLOAT_EQ(world.get_component<Transform>(entities[599])->position.x, 1.0f);
+}
+
+TEST_F(ECSTest, CompactIsTimeSliced) {
+    world.spawn_batch<Transform>(10);
+    const auto e = world.spawn(Hit{.damage = 1.0f});
+    world.spawn_batch<Velocity>(10);
+    
+    // Zero budget: one step per call, so a pass takes several calls
+    int calls = 1;
+    while (!world.compact(std::chrono::microseconds{0})) {
+        ++calls;
+    }
+    EXPECT_GT(calls, 3);
+    EXPECT_FLOAT_EQ(world.get_component<Hit>(e)->damage, 1.0f);
+    EXPECT_EQ(world.entity_count(), 21u);
+}
+
+TEST_F(ECSTest, CompactDrainsArchetypesBetweenFrames) {
+    const auto doomed = world.spawn_batch<Transform, Name>(10);
+    auto movers = world.spawn_batch<Velocity, Name>(1000, [](std::size_t i, Velocity& v, Name& n) {
+        v.linear.x = static_cast<f32>(i);
+        n.value = std::to_string(i);
+    });
+    for (const auto e : doomed) {
+        world.destroy_entity(e);
+    }
+    
+    // One step per call; the world is used between every pair of steps
+    Query<const Velocity, const Name> query{world};
+    int calls = 0;
+    std::size_t spawned = 0;
+    while (!world.compact(std::chrono::microseconds{0})) {
+        ++calls;
+        std::size_t count = 0;
+        query.each([&](Entity, const Velocity& v, const Name& n) {
+            EXPECT_EQ(n.value, std::to_string(static_cast<int>(v.linear.x)));
+            ++count;
+        });
+        EXPECT_EQ(count, movers.size());
+        if (calls % 3 == 0) {
+            movers.push_back(world.spawn(Velocity{.linear = {static_cast<f32>(1000 + spawned), 0.0f, 0.0f}},
+                                         Name{std::to_string(1000 + spawned)}));
+            ++spawned;
+            world.destroy_entity(movers[spawned]);
+            movers.erase(movers.begin() + static_cast<std::ptrdiff_t>(spawned));
+        }
+    }
+    
+    // Several chunks moved one per step, into the old slot
+    EXPECT_GT(calls, 5);
+    EXPECT_EQ(world.archetype_count(), 1u);
+    for (const auto e : movers) {
+        const auto* v = world.get_component<Velocity>(e);
+        ASSERT_NE(v, nullptr);
+        EXPECT_EQ(world.get_component<Name>(e)->value, std::to_string(static_cast<int>(v->linear.x)));
+    }
+}
+
+TEST_F(ECSTest, CompactReorderIsChunkGranular) {
+    world.spawn_batch<Transform, Name>(1000, [](std::size_t i, Transform& t, Name& n) {
+        t.position.x = static_cast<f32>(1000 - i);
+        n.value = std::to_string(1000 - i);
+    });
+    world.advance_tick();
+    const u32 before = world.change_tick();
+    
+    const auto by_x = [this](Entity e) {
+        return static_cast<u64>(std::as_const(world).get_component<Transform>(e)->position.x);
+    };
+    int calls = 1;
+    while (!world.compact(std::chrono::microseconds{0}, by_x)) {
+        ++calls;
+    }
+    EXPECT_GT(calls, 8);  // Keys and placement each take one step per chunk
+    
+    std::vector<f32> order;
+    world.each<Transform, Name>([&](Entity, const Transform& t, const Name& n) {
+        order.push_back(t.position.x);
+        EXPECT_EQ(n.value, std::to_string(static_cast<int>(t.position.x)));
+    });
+    EXPECT_TRUE(std::ranges::is_sorted(order));
+    
+    // Moved rows keep their ticks
+    std::size_t changed = 0;
+    world.each_changed<Transform>(before, [&](Entity, const Transform&) { ++changed; });
+    EXPECT_EQ(changed, 0u);
+}
+
+TEST_F(ECSTest, CompactDropsReorderAfterStructuralChange) {
+    const auto entities = world.spawn_batch<Transform, Name>(1000, [](std::size_t i, Transform& t, Name& n) {
+        t.position.x = static_cast<f32>(1000 - i);
+        n.value = std::to_string(1000 - i);
+    });
+    const auto by_x = [this](Entity e) {
+        return static_cast<u64>(std::as_const(world).get_component<Transform>(e)->position.x);
+    };
+    
+    // Destroy a row mid-reorder: the pass finishes without it, the next one sorts
+    for (int step = 0; step < 6; ++step) {
+        world.compact(std::chrono::microseconds{0}, by_x);
+    }
+    world.destroy_entity(entities[500]);
+    while (!world.compact(std::chrono::microseconds{0}, by_x)) {
+    }
+    while (!world.compact(std::chrono::microseconds::max(), by_x)) {
+    }
+    
+    std::vector<f32> order;
+    world.each<Transform, Name>([&](Entity, const Transform& t, const Name& n) {
+        order.push_back(t.position.x);
+        EXPECT_EQ(n.value, std::to_string(static_cast<int>(t.position.x)));
+    });
+    EXPECT_TRUE(std::ranges::is_sorted(order));
+    EXPECT_EQ(order.size(), 999u);
+}
+
+TEST_F(ECSTest, CompactReleasesTopIds) {
+    const auto entities = world.spawn_batch<Transform>(10);
+    for (std::size_t i = 5; i < entities.size(); ++i) {
+        world.destroy_entity(entities[i]);
+    }
+    world.destroy_entity(entities[1]);
+    while (!world.compact(std::chrono::microseconds::max())) {
+    }
+    
+    // ID 2 is still reused first; IDs 6..10 were released but old handles stay stale
+    EXPECT_EQ(world.create_entity().id(), entities[1].id());
+    const auto fresh = world.create_entity();
+    EXPECT_EQ(fresh.id(), entities[5].id());
+    EXPECT_NE(fresh, entities[5]);
+    EXPECT_FALSE(world.is_alive(entities[5]));
+    EXPECT_TRUE(world.is_alive(fresh));
+}
+
+TEST_F(ECSTest, ClearResetsCompaction) {
+    world.spawn_batch<Transform, Name>(10);
+    world.spawn_batch<Velocity>(5000);
+    const auto key = [](Entity e) { return u64{~0u - e.id()}; };
+    for (int step = 0; step < 4; ++step) {
+        world.compact(std::chrono::microseconds{0}, key);
+    }
+    
+    // A pass resumed after clear() must not touch the old cursors
+    world.clear();
+    world.spawn_batch<Transform>(3);
+    while (!world.compact(std::chrono::microseconds{0}, key)) {
+    }
+    EXPECT_EQ(world.entity_count(), 3u);
+    EXPECT_EQ(world.archetype_count(), 1u);
+}
+
+TEST_F(ECSTest, RestoreDrainsSnapshotTakenMidCompaction) {
+    const auto doomed = world.spawn_batch<Transform>(10);
+    const auto movers = world.spawn_batch<Velocity>(5000, [](std::size_t i, Velocity& v) {
+        v.linear.x = static_cast<f32>(i);
+    });
+    for (const auto e : doomed) {
+        world.destroy_entity(e);
+    }
+    for (int step = 0; step < 3; ++step) {
+        world.compact(std::chrono::microseconds{0});
+    }
+    ASSERT_EQ(world.archetype_count(), 2u);  // Both halves of the drain hold rows
+    auto snapshot = world.snapshot();
+    ASSERT_TRUE(snapshot.has_value());
+    
+    World restored;
+    restored.restore(*snapshot);
+    while (!restored.compact(std::chrono::microseconds::max())) {
+    }
+    EXPECT_EQ(restored.archetype_count(), 1u);
+    for (std::size_t i = 0; i < movers.size(); ++i) {
+        EXPECT_FLOAT_EQ(restored.get_component<Velocity>(movers[i])->linear.x, static_cast<f32>(i));
+    }
+    const auto e = restored.spawn(Velocity{});
+    EXPECT_EQ(restored.archetype_count(), 1u);
+    EXPECT_TRUE(restored.has_component<Velocity>(e));
+}
+
+// ========== Spatial Sort Tests ==========
+
+TEST(SpatialSortTest, CurveEncoding) {
+    EXPECT_EQ(morton_encode(1, 0, 0), 1u);
+    EXPECT_EQ(morton_encode(0, 1, 0), 2u);
+    EXPECT_EQ(morton_encode(0, 0, 1), 4u);
+    EXPECT_EQ(morton_encode(3, 0, 0), 9u);
+    EXPECT_EQ(morton_encode(SPATIAL_KEY_MAX, SPATIAL_KEY_MAX, SPATIAL_KEY_MAX), (u64{1} << 63) - 1);
+    static_assert(hilbert_encode(0, 0, 0) == 0);
+    
+    // First 64 Hilbert indices fill the 4x4x4 cube at the origin, one unit step apart
+    std::vector<std::array<u32, 3>> cells(64, {~0u, ~0u, ~0u});
+    for (u32 x = 0; x < 4; ++x) {
+        for (u32 y = 0; y < 4; ++y) {
+            for (u32 z = 0; z < 4; ++z) {
+                const u64 index = hilbert_encode(x, y, z);
+                ASSERT_LT(index, 64u);
+                EXPECT_EQ(cells[index][0], ~0u);
+                cells[index] = {x, y, z};
+            }
+        }
+    }
+    for (std::size_t i = 1; i < cells.size(); ++i) {
+        u32 distance = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            distance += cells[i][axis] > cells[i - 1][axis] ? cells[i][axis] - cells[i - 1][axis]
+                                                            : cells[i - 1][axis] - cells[i][axis];
+        }
+        EXPECT_EQ(distance, 1u) << "between index " << i - 1 << " and " << i;
+    }
+}
+
+TEST_F(ECSTest, SpatialSortOrdersRowsAlongCurve) {
+    // 8x8x8 grid spawned in scrambled order (odd stride visits every cell once)
+    const auto entities = world.spawn_batch<Transform, Name>(512, [](std::size_t i, Transform& t, Name& n) {
+        const std::size_t cell = (i * 181) % 512;
+        t.position = vec3{static_cast<f32>(cell % 8), static_cast<f32>(cell / 8 % 8), static_cast<f32>(cell / 64)};
+        n.value = std::to_string(cell);
+    });
+    const auto loose = world.spawn(Name{"no transform"});
+    
+    for (const auto curve : {SpaceFillingCurve::MORTON, SpaceFillingCurve::HILBERT}) {
+        EXPECT_EQ(spatial_sort(world, curve), 1u);
+        EXPECT_EQ(spatial_sort(world, curve), 0u);  // Already in order
+        
+        const vec3 lo{0.0f, 0.0f, 0.0f};
+        const vec3 hi{7.0f, 7.0f, 7.0f};
+        std::vector<u64> keys;
+        world.each<Transform, Name>([&](Entity, const Transform& t, const Name& n) {
+            keys.push_back(spatial_key(t.position, lo, hi, curve));
+            const auto cell = static_cast<int>(t.position.x) + 8 * static_cast<int>(t.position.y)
+                            + 64 * static_cast<int>(t.position.z);
+            EXPECT_EQ(n.value, std::to_string(cell));
+        });
+        EXPECT_EQ(keys.size(), 512u);
+        EXPECT_TRUE(std::ranges::is_sorted(keys));
+    }
+    
+    // Handles still resolve to their own components
+    EXPECT_EQ(world.get_component<Name>(entities[1])->value, std::to_string(181));
+    EXPECT_EQ(world.get_component<Name>(loose)->value, "no transform");
+    EXPECT_EQ(world.entity_count(), 513u);
+}
+
+TEST_F(ECSTest, SpatialRowKeyDrivesCompaction) {
+    world.spawn_batch<Transform>(300, [](std::size_t i, Transform& t) {
+        t.position = vec3{static_cast<f32>(300 - i), 0.0f, 0.0f};
+    });
+    while (!world.compact(std::chrono::microseconds::max(), spatial_row_key(world))) {
+    }
+    
+    std::vector<f32> xs;
+    world.each<Transform>([&](Entity, const Transform& t) { xs.push_back(t.position.x); });
+    EXPECT_TRUE(std::ranges::is_sorted(xs));
+    EXPECT_EQ(xs.size(), 300u);
+}
@@ -1,26 +1,128 @@
 /**
  * @file test_serialization.cpp
- * @brief Tests for scene serialization (YAML save/load)
+ * @brief Tests for scene serialization (YAML and binary save/load)
  * 
- * Validates scene persistence with all component types.
+ * Validates scene persistence with all component types, reflected user
+ * components, version-1 files, field migration, binary field encoding and
+ * the .lscene format (round trip, conversion, corrupt / stale files), the
+ * streaming and parallel YAML loaders and journaled (delta) saving.
  * 
  * @author LukeFrankio
  * @date 2025-10-12
  */
 
 #include <luma/scene/serialization.hpp>
+#include <luma/scene/binary_scene.hpp>
 #include <luma/scene/world.hpp>
 #include <luma/scene/component.hpp>
+#include <luma/scene/reflection.hpp>
+#include <luma/scene/registry.hpp>
+#include <luma/core/jobs.hpp>
 #include <luma/core/math.hpp>
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 using namespace luma;
 using namespace luma::scene;
 
+// Reflected game component (not known to the serializer)
+enum class Team : u8 { LEFT, RIGHT };
+
+inline constexpr std::array<std::string_view, 2> TEAM_NAMES{"Left", "Right"};
+
+struct Paddle {
+    f32 speed{10.0f};
+    vec3 extents{0.5f, 3.0f, 0.5f};
+    Team team{Team::LEFT};
+    bool ai{false};
+    std::string label;
+};
+
+template<>
+struct luma::scene::ComponentFields<Paddle> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Paddle, speed),
+        LUMA_FIELD(Paddle, extents),
+        LUMA_ENUM_FIELD(Paddle, team, TEAM_NAMES),
+        LUMA_FIELD(Paddle, ai),
+        LUMA_FIELD(Paddle, label),
+    };
+};
+
+// Older layout of Paddle (fields reordered, one dropped, one added since)
+struct PaddleV1 {
+    i32 score{0};
+    std::string label;
+    f32 speed{1.0f};
+};
+
+template<>
+struct luma::scene::ComponentFields<PaddleV1> {
+    static constexpr std::array fields{
+        LUMA_FIELD(PaddleV1, score),
+        LUMA_FIELD(PaddleV1, label),
+        LUMA_FIELD(PaddleV1, speed),
+    };
+};
+
+struct Frozen {};  // Tag
+
+// Trivially copyable and unpadded, but bool bytes must not be copied raw
+struct Switch {
+    bool on{false};
+    bool armed{false};
+};
+
+template<>
+struct luma::scene::ComponentFields<Switch> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Switch, on),
+        LUMA_FIELD(Switch, armed),
+    };
+};
+
+// Enum over i32 (negative values have no enumerator name)
+enum class Layer : i32 { BACKGROUND = 0, FOREGROUND = 1 };
+inline constexpr std::array<std::string_view, 2> LAYER_NAMES{"Background", "Foreground"};
+
+struct Sprite {
+    Layer layer{Layer::BACKGROUND};
+    Layer fallback{Layer::BACKGROUND};
+};
+
+template<>
+struct luma::scene::ComponentFields<Sprite> {
+    static constexpr std::array fields{
+        LUMA_ENUM_FIELD(Sprite, layer, LAYER_NAMES),
+        LUMA_ENUM_FIELD(Sprite, fallback, LAYER_NAMES),
+    };
+};
+
+// Reflected sparse-set component
+struct Stun {
+    static constexpr StoragePolicy storage_policy = StoragePolicy::SPARSE;
+    f32 seconds{0.0f};
+};
+
+template<>
+struct luma::scene::ComponentFields<Stun> {
+    static constexpr std::array fields{
+        LUMA_FIELD(Stun, seconds),
+    };
+};
+
 class SerializationTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -28,12 +130,12 @@ protected:
         test_dir = std::filesystem::temp_directory_path() / "luma_serialization_tests";
         std::filesystem::create_directories(test_dir);
     }
-
+    
     void TearDown() override {
         // Clean up test files
         std::filesystem::remove_all(test_dir);
     }
-
+    
     std::filesystem::path test_dir;
 };
 
@@ -284,3 +386,887 @@ TEST_F(SerializationTest, PongSceneRoundTrip) {
     });
     EXPECT_TRUE(ball_found);
 }
+
+// ========== Reflection Tests ==========
+
+TEST(ReflectionTest, BuiltinFieldTablesMatchLayout) {
+    static_assert(fields_of<Transform>().size() == 3);
+    static_assert(fields_of<Transform>()[1].offset == offsetof(Transform, rotation));
+    static_assert(fields_of<Transform>()[1].type == FieldType::QUAT);
+    static_assert(fields_of<Geometry>()[0].type == FieldType::U8);
+    static_assert(fields_trivially_copyable(fields_of<Material>()));
+    static_assert(!fields_trivially_copyable(fields_of<Name>()));
+    
+    const auto& registry = ComponentRegistry::instance();
+    EXPECT_EQ(registry.fields(component_id<Material>()).size(), 5u);
+    EXPECT_EQ(registry.fields(component_id<Paddle>()).size(), 5u);
+    ASSERT_NE(find_field(registry.fields(component_id<Geometry>()), "rounding"), nullptr);
+    EXPECT_EQ(find_field(registry.fields(component_id<Geometry>()), "rounding")->offset, offsetof(Geometry, rounding));
+    EXPECT_EQ(find_field(fields_of<Velocity>(), "angular"), nullptr);
+}
+
+TEST(ReflectionTest, MigrateFieldsByName) {
+    const PaddleV1 old{.score = 7, .label = "P1", .speed = 4.0f};
+    Paddle current;
+    
+    // label and speed carry over; score is gone; extents/team keep defaults
+    EXPECT_EQ(migrate_fields(fields_of<Paddle>(), &current, fields_of<PaddleV1>(), &old), 2u);
+    EXPECT_FLOAT_EQ(current.speed, 4.0f);
+    EXPECT_EQ(current.label, "P1");
+    EXPECT_EQ(current.extents, vec3(0.5f, 3.0f, 0.5f));
+    EXPECT_EQ(current.team, Team::LEFT);
+}
+
+TEST(ReflectionTest, BinaryFieldsRoundTrip) {
+    const Paddle paddle{.speed = 2.5f, .extents = {1, 2, 3}, .team = Team::RIGHT, .ai = true, .label = "right paddle"};
+    std::vector<std::byte> bytes;
+    write_fields(fields_of<Paddle>(), &paddle, bytes);
+    EXPECT_EQ(bytes.size(), 4u + 12u + 1u + 1u + 4u + paddle.label.size());
+    
+    Paddle decoded;
+    const auto consumed = read_fields(fields_of<Paddle>(), &decoded, bytes);
+    ASSERT_TRUE(consumed.has_value());
+    EXPECT_EQ(*consumed, bytes.size());
+    EXPECT_FLOAT_EQ(decoded.speed, 2.5f);
+    EXPECT_EQ(decoded.extents, vec3(1, 2, 3));
+    EXPECT_EQ(decoded.team, Team::RIGHT);
+    EXPECT_TRUE(decoded.ai);
+    EXPECT_EQ(decoded.label, "right paddle");
+    
+    // Truncated input is rejected, not over-read
+    Paddle partial;
+    EXPECT_FALSE(read_fields(fields_of<Paddle>(), &partial, std::span(bytes).first(bytes.size() - 1)).has_value());
+}
+
+TEST_F(SerializationTest, ReflectedUserComponentRoundTrip) {
+    ComponentRegistry::instance().register_component<Paddle>("Paddle");
+    ComponentRegistry::instance().register_component<Frozen>("Frozen");
+    
+    World world;
+    const auto left = world.spawn(Transform{}, Paddle{.speed = 12.0f, .label = "left"});
+    world.add_component(left, Frozen{});
+    world.spawn(Paddle{.team = Team::RIGHT, .ai = true, .label = "right"});  // No Transform
+    
+    const auto path = test_dir / "paddles.yaml";
+    ASSERT_TRUE(save_scene(world, path).has_value());
+    
+    std::ifstream file(path);
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NE(text.find("team: Right"), std::string::npos);  // Enumerator names, not numbers
+    
+    World loaded;
+    ASSERT_TRUE(load_scene(loaded, path).has_value());
+    EXPECT_EQ(loaded.entity_count(), 2u);
+    
+    int found = 0;
+    loaded.each<Paddle>([&](Entity e, const Paddle& p) {
+        ++found;
+        if (p.label == "left") {
+            EXPECT_FLOAT_EQ(p.speed, 12.0f);
+            EXPECT_TRUE(loaded.has_component<Frozen>(e));
+            EXPECT_TRUE(loaded.has_component<Transform>(e));
+        } else {
+            EXPECT_EQ(p.label, "right");
+            EXPECT_EQ(p.team, Team::RIGHT);
+            EXPECT_TRUE(p.ai);
+            EXPECT_FALSE(loaded.has_component<Frozen>(e));
+        }
+    });
+    EXPECT_EQ(found, 2);
+}
+
+TEST_F(SerializationTest, I32EnumsUseEnumeratorNames) {
+    ComponentRegistry::instance().register_component<Sprite>("Sprite");
+    
+    World world;
+    world.spawn(Sprite{.layer = Layer::FOREGROUND, .fallback = static_cast<Layer>(-3)});
+    const auto path = test_dir / "sprites.yaml";
+    ASSERT_TRUE(save_scene(world, path).has_value());
+    
+    std::ifstream file(path);
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NE(text.find("layer: Foreground"), std::string::npos);
+    EXPECT_NE(text.find("fallback: -3"), std::string::npos);  // No name: written as a number
+    
+    World loaded;
+    ASSERT_TRUE(load_scene(loaded, path).has_value());
+    int found = 0;
+    loaded.each<Sprite>([&](Entity, const Sprite& sprite) {
+        ++found;
+        EXPECT_EQ(sprite.layer, Layer::FOREGROUND);
+        EXPECT_EQ(static_cast<i32>(sprite.fallback), -3);
+    });
+    EXPECT_EQ(found, 1);
+}
+
+TEST_F(SerializationTest, LoadsVersion1Layouts) {
+    const auto path = test_dir / "v1.yaml";
+    std::ofstream file(path);
+    file << R"(version: 1
+entities:
+  - Transform:
+      position: [1.0, 2.0, 3.0]
+      rotation: [1.0, 0.0, 0.0, 0.0]
+      scale: [1.0, 1.0, 1.0]
+    Geometry:
+      type: box
+      extents: [0.5, 4.0, 0.5]
+      rounding: 0.2
+    Material:
+      albedo: [0.2, 0.6, 1.0]
+  - Transform:
+      position: [0.0, 10.0, 0.0]
+      rotation: [1.0, 0.0, 0.0, 0.0]
+      scale: [1.0, 1.0, 1.0]
+    Geometry:
+      type: Plane
+      normal: [0.0, -1.0, 0.0]
+      distance: 2.0
+)";
+    file.close();
+    
+    World world;
+    ASSERT_TRUE(load_scene(world, path).has_value());
+    EXPECT_EQ(world.entity_count(), 2u);
+    
+    int boxes = 0;
+    int planes = 0;
+    world.each<Geometry>([&](Entity e, const Geometry& g) {
+        if (g.type == SDFType::BOX) {
+            ++boxes;
+            EXPECT_EQ(g.params, vec4(0.5f, 4.0f, 0.5f, 0.0f));
+            EXPECT_FLOAT_EQ(g.rounding, 0.2f);
+            const auto* material = world.get_component<Material>(e);
+            ASSERT_NE(material, nullptr);
+            EXPECT_EQ(material->base_color, vec3(0.2f, 0.6f, 1.0f));
+            EXPECT_FLOAT_EQ(material->ior, 1.45f);
+        } else {
+            ++planes;
+            EXPECT_EQ(g.type, SDFType::PLANE);
+            EXPECT_EQ(g.params, vec4(0.0f, -1.0f, 0.0f, 2.0f));
+        }
+    });
+    EXPECT_EQ(boxes, 1);
+    EXPECT_EQ(planes, 1);
+}
+
+TEST_F(SerializationTest, Version1KeepsRequiredKeys) {
+    const auto path = test_dir / "v1_incomplete.yaml";
+    std::ofstream file(path);
+    file << R"(version: 1
+entities:
+  - Name:
+      value: no radius
+    Geometry:
+      type: sphere
+    Material:
+      roughness: 0.5
+  - Name:
+      value: no extents
+    Geometry:
+      type: box
+      rounding: 0.1
+  - Name:
+      value: no normal
+    Geometry:
+      type: plane
+      distance: 1.0
+  - Name:
+      value: unknown shape
+    Geometry:
+      type: torus
+      radius: 1.0
+  - Name:
+      value: complete
+    Geometry:
+      type: sphere
+      radius: 2.0
+    Material:
+      base_color: [1.0, 0.0, 0.0]
+)";
+    file.close();
+    
+    // Incomplete components are skipped; the entities still load
+    World world;
+    ASSERT_TRUE(load_scene(world, path).has_value());
+    EXPECT_EQ(world.entity_count(), 5u);
+    int geometries = 0;
+    world.each<Geometry, Name>([&](Entity e, const Geometry& g, const Name& name) {
+        ++geometries;
+        EXPECT_EQ(name.value, "complete");
+        EXPECT_FLOAT_EQ(g.params.x, 2.0f);
+        EXPECT_TRUE(world.has_component<Material>(e));
+    });
+    EXPECT_EQ(geometries, 1);
+    std::size_t materials = 0;
+    world.each<Material>([&](Entity, const Material&) { ++materials; });
+    EXPECT_EQ(materials, 1u);
+}
+
+// ========== Binary Scene Tests ==========
+
+TEST_F(SerializationTest, BinarySceneRoundTrip) {
+    auto& registry = ComponentRegistry::instance();
+    registry.register_component<Paddle>("Paddle");
+    registry.register_component<Frozen>("Frozen");
+    registry.register_component<Stun>("Stun");
+    
+    // Enough rows to span several chunks
+    constexpr u32 COUNT = 3000;
+    World world;
+    for (u32 i = 0; i < COUNT; ++i) {
+        const auto e = world.spawn(
+            Transform{.position = vec3(static_cast<f32>(i), 0.0f, 0.0f)},
+            Name{"entity_" + std::to_string(i)}
+        );
+        if (i % 100 == 0) {
+            world.add_component(e, Stun{.seconds = static_cast<f32>(i)});
+        }
+    }
+    const auto left = world.spawn(Paddle{.speed = 7.0f, .team = Team::RIGHT, .ai = true, .label = "left"});
+    world.add_component(left, Frozen{});
+    const auto loose = world.create_entity();
+    world.add_component(loose, Stun{.seconds = -1.0f});  // Lives in no archetype block
+    
+    const auto path = test_dir / "scene.lscene";
+    ASSERT_TRUE(save_binary_scene(world, path).has_value());
+    
+    World loaded;
+    ASSERT_TRUE(load_binary_scene(loaded, path).has_value());
+    EXPECT_EQ(loaded.entity_count(), COUNT + 2);
+    
+    std::size_t named = 0;
+    loaded.each<Transform, Name>([&](Entity e, const Transform& t, const Name& n) {
+        const auto i = static_cast<u32>(t.position.x);
+        EXPECT_EQ(n.value, "entity_" + std::to_string(i));
+        const auto* stun = loaded.get_component<Stun>(e);
+        EXPECT_EQ(stun != nullptr, i % 100 == 0);
+        if (stun) {
+            EXPECT_FLOAT_EQ(stun->seconds, static_cast<f32>(i));
+        }
+        ++named;
+    });
+    EXPECT_EQ(named, COUNT);
+    
+    int paddles = 0;
+    loaded.each<Paddle>([&](Entity e, const Paddle& p) {
+        ++paddles;
+        EXPECT_FLOAT_EQ(p.speed, 7.0f);
+        EXPECT_EQ(p.team, Team::RIGHT);
+        EXPECT_TRUE(p.ai);
+        EXPECT_EQ(p.label, "left");
+        EXPECT_TRUE(loaded.has_component<Frozen>(e));
+    });
+    EXPECT_EQ(paddles, 1);
+    
+    int stunned = 0;
+    loaded.each<Stun>([&](Entity, const Stun& s) {
+        stunned += s.seconds < 0.0f ? 1 : 0;
+    });
+    EXPECT_EQ(stunned, 1);
+}
+
+TEST_F(SerializationTest, ConvertsBetweenYamlAndBinary) {
+    World world;
+    world.spawn(Transform{.position = vec3(1.0f, 2.0f, 3.0f)}, Name{"a"});
+    world.spawn(Geometry{.type = SDFType::PLANE, .params = vec4(0.0f, 1.0f, 0.0f, 0.5f)}, Material{});
+    
+    const auto yaml = test_dir / "source.yaml";
+    const auto binary = test_dir / "build" / "source.lscene";
+    const auto back = test_dir / "back.yml";
+    ASSERT_TRUE(save_scene(world, yaml).has_value());
+    ASSERT_TRUE(convert_scene(yaml, binary).has_value());
+    ASSERT_TRUE(convert_scene(binary, back).has_value());
+    
+    World loaded;
+    ASSERT_TRUE(load_scene(loaded, back).has_value());
+    EXPECT_EQ(loaded.entity_count(), 2u);
+    loaded.each<Transform, Name>([](Entity, const Transform& t, const Name& n) {
+        EXPECT_EQ(t.position, vec3(1.0f, 2.0f, 3.0f));
+        EXPECT_EQ(n.value, "a");
+    });
+    loaded.each<Geometry>([](Entity, const Geometry& g) {
+        EXPECT_EQ(g.type, SDFType::PLANE);
+        EXPECT_EQ(g.params, vec4(0.0f, 1.0f, 0.0f, 0.5f));
+    });
+    
+    const auto unknown = convert_scene(yaml, test_dir / "scene.txt");
+    ASSERT_FALSE(unknown.has_value());
+    EXPECT_EQ(unknown.error(), SerializationError::UNKNOWN_FILE_FORMAT);
+}
+
+TEST_F(SerializationTest, BinaryRawColumnsOnlyForPlainBytes) {
+    ComponentRegistry::instance().register_component<Switch>("Switch");
+    
+    World world;
+    world.spawn(Velocity{.linear = vec3(1.0f, 2.0f, 3.0f)});
+    world.spawn(Geometry::box(vec3(1.0f, 2.0f, 3.0f), 0.25f), Switch{.on = true});
+    const auto path = test_dir / "encodings.lscene";
+    ASSERT_TRUE(save_binary_scene(world, path).has_value());
+    
+    // Column encoding by component name (header: component_table 40,
+    // column_table 56, name_table 64, column_count 88)
+    std::ifstream in(path, std::ios::binary);
+    const std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const auto read = [&bytes]<typename T>(std::size_t offset, std::type_identity<T>) {
+        T value{};
+        std::memcpy(&value, bytes.data() + offset, sizeof(value));
+        return value;
+    };
+    const auto component_table = read(40, std::type_identity<u64>{});
+    const auto column_table = read(56, std::type_identity<u64>{});
+    const auto name_table = read(64, std::type_identity<u64>{});
+    std::unordered_map<std::string, u32> encodings;
+    for (u32 c = 0; c < read(88, std::type_identity<u32>{}); ++c) {
+        const auto record = component_table + 16 * read(column_table + 24 * c + 16, std::type_identity<u32>{});
+        const std::string name(bytes.data() + name_table + read(record + 8, std::type_identity<u32>{}),
+                               read(record + 12, std::type_identity<u32>{}));
+        encodings[name] = read(column_table + 24 * c + 20, std::type_identity<u32>{});
+    }
+    EXPECT_EQ(encodings.at("Velocity"), 0u);  // RAW
+    EXPECT_EQ(encodings.at("Geometry"), 1u);  // FIELDS: padding after `type`
+    EXPECT_EQ(encodings.at("Switch"), 1u);  // FIELDS: bools
+    
+    World loaded;
+    ASSERT_TRUE(load_binary_scene(loaded, path).has_value());
+    int found = 0;
+    loaded.each<Geometry, Switch>([&](Entity, const Geometry& g, const Switch& s) {
+        ++found;
+        EXPECT_EQ(g.type, SDFType::BOX);
+        EXPECT_EQ(g.params, vec4(1.0f, 2.0f, 3.0f, 0.0f));
+        EXPECT_FLOAT_EQ(g.rounding, 0.25f);
+        EXPECT_TRUE(s.on);
+        EXPECT_FALSE(s.armed);
+    });
+    EXPECT_EQ(found, 1);
+}
+
+TEST_F(SerializationTest, BinarySceneRejectsCorruptFiles) {
+    World world;
+    for (int i = 0; i < 10; ++i) {
+        world.spawn(Transform{}, Name{"n" + std::to_string(i)});
+    }
+    const auto path = test_dir / "good.lscene";
+    ASSERT_TRUE(save_binary_scene(world, path).has_value());
+    
+    std::ifstream in(path, std::ios::binary);
+    const std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const auto write = [&](const std::filesystem::path& file, const std::vector<char>& data) {
+        std::ofstream out(file, std::ios::binary);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+    
+    World target;
+    const auto keep = target.spawn(Name{"keep"});
+    
+    // Truncated
+    write(test_dir / "short.lscene", std::vector<char>(bytes.begin(), bytes.end() - 8));
+    auto result = load_binary_scene(target, test_dir / "short.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::CORRUPT_FILE);
+    
+    // Bad magic
+    auto bad = bytes;
+    bad[0] = 'X';
+    write(test_dir / "magic.lscene", bad);
+    result = load_binary_scene(target, test_dir / "magic.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::CORRUPT_FILE);
+    
+    // Stale component layout (first layout hash altered; the header stores
+    // the component table offset at byte 40)
+    u64 component_table = 0;
+    std::memcpy(&component_table, bytes.data() + 40, sizeof(component_table));
+    auto stale = bytes;
+    stale[component_table] ^= 0x5a;
+    write(test_dir / "stale.lscene", stale);
+    result = load_binary_scene(target, test_dir / "stale.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::COMPONENT_LAYOUT_MISMATCH);
+    
+    // Header fields (byte offsets): entity_count 24, loose_entities 32,
+    // block_table 48, column_table 56, column_count 88
+    const auto patch = [](std::vector<char>& data, std::size_t offset, auto value) {
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    };
+    
+    // Block with no columns, pointing one past the column table
+    u64 block_table = 0;
+    u32 column_count = 0;
+    std::memcpy(&block_table, bytes.data() + 48, sizeof(block_table));
+    std::memcpy(&column_count, bytes.data() + 88, sizeof(column_count));
+    auto empty_block = bytes;
+    patch(empty_block, block_table + 16, column_count);  // first_column
+    patch(empty_block, block_table + 20, u32{0});  // column_count
+    write(test_dir / "empty_block.lscene", empty_block);
+    result = load_binary_scene(target, test_dir / "empty_block.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::CORRUPT_FILE);
+    
+    // One block listing the same component twice (column record 1 copied over 0)
+    u64 column_table = 0;
+    std::memcpy(&column_table, bytes.data() + 56, sizeof(column_table));
+    auto twice = bytes;
+    std::memcpy(twice.data() + column_table, bytes.data() + column_table + 24, 24);
+    write(test_dir / "twice.lscene", twice);
+    result = load_binary_scene(target, test_dir / "twice.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::CORRUPT_FILE);
+    
+    // Two component records with the same name (record 0's name range copied into record 1)
+    auto same_name = bytes;
+    std::memcpy(same_name.data() + component_table + 16 + 8, bytes.data() + component_table + 8, 8);
+    write(test_dir / "same_name.lscene", same_name);
+    result = load_binary_scene(target, test_dir / "same_name.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::CORRUPT_FILE);
+    
+    // Entity count no world could hold (kept consistent via loose entities)
+    auto huge = bytes;
+    patch(huge, 24, u64{1} << 40);
+    patch(huge, 32, (u64{1} << 40) - 10);
+    write(test_dir / "huge.lscene", huge);
+    result = load_binary_scene(target, test_dir / "huge.lscene");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::CORRUPT_FILE);
+    
+    // World untouched by every failed load
+    EXPECT_EQ(target.entity_count(), 1u);
+    ASSERT_TRUE(target.is_alive(keep));
+    EXPECT_EQ(target.get_component<Name>(keep)->value, "keep");
+}
+
+// ========== Streaming Loader Tests ==========
+
+TEST_F(SerializationTest, StreamingLoadMatchesLoadScene) {
+    ComponentRegistry::instance().register_component<Paddle>("Paddle");
+    ComponentRegistry::instance().register_component<Frozen>("Frozen");
+    
+    constexpr u32 COUNT = 500;
+    World world;
+    for (u32 i = 0; i < COUNT; ++i) {
+        world.spawn(Transform{.position = vec3(static_cast<f32>(i), 1.0f, 2.0f)}, Name{"n" + std::to_string(i)});
+    }
+    const auto paddle = world.spawn(Paddle{.team = Team::RIGHT, .label = "p"}, Geometry::box(vec3(1.0f), 0.1f));
+    world.add_component(paddle, Frozen{});
+    
+    const auto path = test_dir / "stream.yaml";
+    ASSERT_TRUE(save_scene(world, path).has_value());
+    
+    World loaded;
+    loaded.spawn(Name{"stale"});  // Cleared by the load
+    ASSERT_TRUE(load_scene_streaming(loaded, path, 7).has_value());  // Tiny buffer: parser blocks often
+    EXPECT_EQ(loaded.entity_count(), COUNT + 1);
+    
+    std::size_t named = 0;
+    loaded.each<Transform, Name>([&](Entity, const Transform& t, const Name& n) {
+        EXPECT_EQ(n.value, "n" + std::to_string(static_cast<u32>(t.position.x)));
+        EXPECT_EQ(t.position.y, 1.0f);
+        ++named;
+    });
+    EXPECT_EQ(named, COUNT);
+    
+    int paddles = 0;
+    loaded.each<Paddle, Geometry>([&](Entity e, const Paddle& p, const Geometry& g) {
+        ++paddles;
+        EXPECT_EQ(p.team, Team::RIGHT);
+        EXPECT_EQ(p.label, "p");
+        EXPECT_EQ(g.type, SDFType::BOX);
+        EXPECT_TRUE(loaded.has_component<Frozen>(e));
+    });
+    EXPECT_EQ(paddles, 1);
+}
+
+TEST_F(SerializationTest, StreamingLoaderYieldsBetweenBatches) {
+    World world;
+    for (int i = 0; i < 250; ++i) {
+        world.spawn(Transform{});
+    }
+    const auto path = test_dir / "batches.yaml";
+    ASSERT_TRUE(save_scene(world, path).has_value());
+    
+    World loaded;
+    SceneStreamLoader loader(loaded, path, 16);
+    int steps = 0;
+    while (true) {
+        const auto before = loader.loaded_count();
+        const auto done = loader.step(100);
+        ASSERT_TRUE(done.has_value());
+        EXPECT_LE(loader.loaded_count() - before, 100u);
+        ++steps;
+        if (*done) {
+            break;
+        }
+    }
+    EXPECT_GE(steps, 3);
+    EXPECT_EQ(loader.loaded_count(), 250u);
+    EXPECT_EQ(loaded.entity_count(), 250u);
+    
+    // Abandoning a load part-way must not hang on the blocked parser
+    World partial;
+    {
+        SceneStreamLoader abandoned(partial, path, 4);
+        ASSERT_TRUE(abandoned.step(1).has_value());
+    }
+    EXPECT_EQ(partial.entity_count(), 1u);
+}
+
+TEST_F(SerializationTest, StreamingLoaderErrors) {
+    World world;
+    const auto keep = world.spawn(Name{"keep"});
+    
+    auto result = load_scene_streaming(world, test_dir / "missing.yaml");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::FILE_NOT_FOUND);
+    
+    const auto write = [&](const char* name, const char* text) {
+        std::ofstream(test_dir / name) << text;
+        return test_dir / name;
+    };
+    
+    result = load_scene_streaming(world, write("invalid.yaml", "this is not valid yaml: [unclosed bracket\n"));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::YAML_PARSE_ERROR);
+    
+    result = load_scene_streaming(world, write("noversion.yaml", "entities:\n  - Name: {value: a}\n"));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::MISSING_REQUIRED_FIELD);
+    
+    result = load_scene_streaming(world, write("future.yaml", "version: 99\nentities: []\n"));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::UNSUPPORTED_VERSION);
+    
+    // Failures before the version is accepted leave the world alone
+    EXPECT_EQ(world.entity_count(), 1u);
+    EXPECT_TRUE(world.is_alive(keep));
+    
+    result = load_scene_streaming(world, write("noentities.yaml", "version: 2\nentities: {}\n"));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::INVALID_COMPONENT_DATA);
+}
+
+TEST_F(SerializationTest, StreamingLoaderVersionAfterEntities) {
+    std::string text = "entities:\n";
+    for (int i = 0; i < 40; ++i) {
+        text += "  - Name: {value: e" + std::to_string(i) + "}\n";
+    }
+    text += "version: 2\n";
+    const auto path = test_dir / "version_last.yaml";
+    std::ofstream(path) << text;
+    
+    World expected;
+    ASSERT_TRUE(load_scene(expected, path).has_value());
+    
+    World loaded;
+    ASSERT_TRUE(load_scene_streaming(loaded, path, 4).has_value());  // More entities than the buffer holds
+    EXPECT_EQ(loaded.entity_count(), expected.entity_count());
+    EXPECT_EQ(loaded.entity_count(), 40u);
+}
+
+// ========== Parallel Loader Tests ==========
+
+TEST_F(SerializationTest, ParallelLoadMatchesLoadScene) {
+    auto& registry = ComponentRegistry::instance();
+    registry.register_component<Paddle>("Paddle");
+    registry.register_component<Frozen>("Frozen");
+    registry.register_component<Stun>("Stun");
+    
+    auto jobs_result = JobSystem::create(4);
+    ASSERT_TRUE(jobs_result.has_value());
+    auto& jobs = **jobs_result;
+    
+    // Runs of different archetypes interleaved, so ranges and runs disagree
+    constexpr u32 COUNT = 3000;
+    World world;
+    for (u32 i = 0; i < COUNT; ++i) {
+        const auto e = world.spawn(Transform{.position = vec3(static_cast<f32>(i), 0.0f, 0.0f)});
+        if (i % 3 != 0) {
+            world.add_component(e, Name{"n" + std::to_string(i)});
+        }
+        if (i % 50 == 0) {
+            world.add_component(e, Stun{.seconds = static_cast<f32>(i)});
+        }
+        if (i % 500 == 0) {
+            world.add_component(e, Paddle{.label = "p" + std::to_string(i)});
+            world.add_component(e, Frozen{});
+        }
+    }
+    const auto path = test_dir / "parallel.yaml";
+    ASSERT_TRUE(save_scene(world, path).has_value());
+    
+    World serial;
+    ASSERT_TRUE(load_scene(serial, path).has_value());
+    World parallel;
+    parallel.spawn(Name{"stale"});  // Cleared by the load
+    ASSERT_TRUE(load_scene_parallel(parallel, path, jobs).has_value());
+    
+    ASSERT_EQ(parallel.entity_count(), serial.entity_count());
+    EXPECT_EQ(parallel.entity_count(), COUNT);
+    
+    // Entities are created in file order
+    f32 previous = -1.0f;
+    for (const Entity e : parallel.entities()) {
+        const auto* transform = parallel.get_component<Transform>(e);
+        ASSERT_NE(transform, nullptr);
+        const auto i = static_cast<u32>(transform->position.x);
+        EXPECT_GT(transform->position.x, previous);
+        previous = transform->position.x;
+        
+        const auto* name = parallel.get_component<Name>(e);
+        EXPECT_EQ(name != nullptr, i % 3 != 0);
+        if (name) {
+            EXPECT_EQ(name->value, "n" + std::to_string(i));
+        }
+        const auto* stun = parallel.get_component<Stun>(e);
+        EXPECT_EQ(stun != nullptr, i % 50 == 0);
+        if (stun) {
+            EXPECT_FLOAT_EQ(stun->seconds, static_cast<f32>(i));
+        }
+        const auto* paddle = parallel.get_component<Paddle>(e);
+        EXPECT_EQ(paddle != nullptr, i % 500 == 0);
+        if (paddle) {
+            EXPECT_EQ(paddle->label, "p" + std::to_string(i));
+            EXPECT_TRUE(parallel.has_component<Frozen>(e));
+        }
+    }
+}
+
+TEST_F(SerializationTest, ParallelLoadErrorsLeaveWorldUntouched) {
+    auto jobs_result = JobSystem::create(2);
+    ASSERT_TRUE(jobs_result.has_value());
+    auto& jobs = **jobs_result;
+    
+    World world;
+    world.spawn(Name{"keep"});
+    
+    auto result = load_scene_parallel(world, test_dir / "missing.yaml", jobs);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::FILE_NOT_FOUND);
+    
+    const auto path = test_dir / "noversion.yaml";
+    std::ofstream(path) << "entities:\n  - Name: {value: a}\n";
+    result = load_scene_parallel(world, path, jobs);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), SerializationError::MISSING_REQUIRED_FIELD);
+    
+    EXPECT_EQ(world.entity_count(), 1u);
+}
+
+// ========== Scene Journal Tests ==========
+
+namespace {
+
+auto find_named(World& world, std::string_view name) -> Entity {
+    Entity found = NULL_ENTITY;
+    world.each<Name>([&](Entity e, const Name& n) {
+        if (n.value == name) {
+            found = e;
+        }
+    });
+    return found;
+}
+
+auto read_text(const std::filesystem::path& path) -> std::string {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+} // anonymous namespace
+
+TEST_F(SerializationTest, JournalWritesOnlyChanges) {
+    auto& registry = ComponentRegistry::instance();
+    registry.register_component<Paddle>("Paddle");
+    registry.register_component<Stun>("Stun");
+    
+    World world;
+    std::vector<Entity> es;
+    for (int i = 0; i < 200; ++i) {
+        es.push_back(world.spawn(Transform{}, Name{"e" + std::to_string(i)}));
+    }
+    
+    const auto path = test_dir / "autosave.yaml";
+    SceneJournal journal(path);
+    auto written = journal.save(world);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(*written, JournalWrite::FULL);
+    
+    world.advance_tick();
+    world.get_component<Transform>(es[1])->position = vec3(5.0f);
+    world.add_component(es[2], Velocity{.linear = vec3(1.0f, 2.0f, 3.0f)});
+    world.remove_component<Name>(es[3]);
+    world.destroy_entity(es[4]);
+    world.spawn(Name{"new"}, Paddle{.label = "fresh"});  // May reuse the destroyed ID
+    world.add_component(es[5], Stun{.seconds = 2.0f});
+    
+    written = journal.save(world);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(*written, JournalWrite::DELTA);
+    EXPECT_EQ(journal.delta_count(), 1u);
+    
+    const auto delta = read_text(journal.journal_path());
+    EXPECT_LT(delta.size(), std::filesystem::file_size(path) / 4);
+    EXPECT_EQ(delta.find("e10"), std::string::npos);  // Untouched entities are not written
+    EXPECT_NE(delta.find("fresh"), std::string::npos);
+    
+    world.advance_tick();
+    written = journal.save(world);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(*written, JournalWrite::UNCHANGED);
+    
+    World loaded;
+    ASSERT_TRUE(load_scene_journal(loaded, path).has_value());
+    EXPECT_EQ(loaded.entity_count(), world.entity_count());
+    
+    const auto e1 = find_named(loaded, "e1");
+    ASSERT_FALSE(e1.is_null());
+    EXPECT_EQ(loaded.get_component<Transform>(e1)->position, vec3(5.0f));
+    const auto e2 = find_named(loaded, "e2");
+    ASSERT_NE(loaded.get_component<Velocity>(e2), nullptr);
+    EXPECT_EQ(loaded.get_component<Velocity>(e2)->linear, vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_TRUE(find_named(loaded, "e3").is_null());
+    EXPECT_TRUE(find_named(loaded, "e4").is_null());
+    const auto e5 = find_named(loaded, "e5");
+    ASSERT_NE(loaded.get_component<Stun>(e5), nullptr);
+    EXPECT_FLOAT_EQ(loaded.get_component<Stun>(e5)->seconds, 2.0f);
+    const auto fresh = find_named(loaded, "new");
+    ASSERT_NE(loaded.get_component<Paddle>(fresh), nullptr);
+    EXPECT_EQ(loaded.get_component<Paddle>(fresh)->label, "fresh");
+    
+    std::size_t unnamed = 0;
+    loaded.each<Transform>([&](Entity e, const Transform&) {
+        unnamed += loaded.has_component<Name>(e) ? 0 : 1;
+    });
+    EXPECT_EQ(unnamed, 1u);
+}
+
+TEST_F(SerializationTest, JournalSeesWritesInSaveTick) {
+    World world;
+    const auto e = world.spawn(Transform{}, Name{"a"});
+    for (int i = 0; i < 50; ++i) {
+        world.spawn(Transform{}, Name{"pad" + std::to_string(i)});
+    }
+    
+    const auto path = test_dir / "same_tick.yaml";
+    SceneJournal journal(path);
+    ASSERT_EQ(journal.save(world).value(), JournalWrite::FULL);
+    world.advance_tick();
+    world.get_component<Transform>(e)->position.x = 1.0f;
+    ASSERT_EQ(journal.save(world).value(), JournalWrite::DELTA);
+    
+    // Written in the same frame as the save, before the frame ends
+    world.get_component<Transform>(e)->position.x = 5.0f;
+    world.advance_tick();
+    ASSERT_EQ(journal.save(world).value(), JournalWrite::DELTA);
+    
+    World loaded;
+    ASSERT_TRUE(load_scene_journal(loaded, path).has_value());
+    EXPECT_EQ(loaded.get_component<Transform>(find_named(loaded, "a"))->position.x, 5.0f);
+}
+
+TEST_F(SerializationTest, JournalCompacts) {
+    World world;
+    const auto e = world.spawn(Transform{}, Name{"a"});
+    for (int i = 0; i < 50; ++i) {
+        world.spawn(Transform{}, Name{"pad" + std::to_string(i)});
+    }
+    
+    const auto path = test_dir / "compact.yaml";
+    SceneJournal journal(path, JournalOptions{.max_deltas = 2, .max_journal_ratio = 1.0});
+    ASSERT_EQ(journal.save(world).value(), JournalWrite::FULL);
+    
+    for (int i = 1; i <= 3; ++i) {
+        world.advance_tick();
+        world.get_component<Transform>(e)->position.x = static_cast<f32>(i);
+        const auto written = journal.save(world);
+        ASSERT_TRUE(written.has_value());
+        EXPECT_EQ(*written, i < 3 ? JournalWrite::DELTA : JournalWrite::FULL);  // Third delta compacts
+    }
+    EXPECT_EQ(journal.delta_count(), 0u);
+    EXPECT_EQ(std::filesystem::file_size(journal.journal_path()), 0u);
+    
+    // A journal outgrowing its ratio compacts too
+    SceneJournal small(test_dir / "ratio.yaml", JournalOptions{.max_deltas = 64, .max_journal_ratio = 0.0});
+    ASSERT_EQ(small.save(world).value(), JournalWrite::FULL);
+    world.advance_tick();
+    world.get_component<Transform>(e)->position.x = 10.0f;
+    ASSERT_EQ(small.save(world).value(), JournalWrite::FULL);
+    
+    World loaded;
+    ASSERT_TRUE(load_scene_journal(loaded, path).has_value());
+    EXPECT_EQ(loaded.get_component<Transform>(find_named(loaded, "a"))->position.x, 3.0f);
+}
+
+TEST_F(SerializationTest, JournalIgnoresStaleAndTornDeltas) {
+    World world;
+    const auto e = world.spawn(Transform{}, Name{"a"});
+    for (int i = 0; i < 50; ++i) {
+        world.spawn(Transform{}, Name{"pad" + std::to_string(i)});
+    }
+    
+    const auto path = test_dir / "crash.yaml";
+    SceneJournal journal(path);
+    ASSERT_TRUE(journal.save(world).has_value());
+    world.advance_tick();
+    world.get_component<Transform>(e)->position.x = 1.0f;
+    ASSERT_EQ(journal.save(world).value(), JournalWrite::DELTA);
+    const auto stale = read_text(journal.journal_path());
+    
+    // Compaction interrupted before the journal was emptied, then one more
+    // delta, then a crash half-way through appending the next one
+    world.advance_tick();
+    world.get_component<Transform>(e)->position.x = 2.0f;
+    ASSERT_TRUE(journal.compact(world).has_value());
+    world.advance_tick();
+    world.get_component<Transform>(e)->position.y = 3.0f;
+    ASSERT_EQ(journal.save(world).value(), JournalWrite::DELTA);
+    const auto current = read_text(journal.journal_path());
+    std::ofstream(journal.journal_path(), std::ios::binary | std::ios::trunc)
+        << stale << current << "---\nepoch: 1\nentities:\n  - id: 1\n    Transform: {position: [9";
+    
+    World loaded;
+    ASSERT_TRUE(load_scene_journal(loaded, path).has_value());
+    EXPECT_EQ(loaded.entity_count(), world.entity_count());
+    EXPECT_EQ(loaded.get_component<Transform>(find_named(loaded, "a"))->position, vec3(2.0f, 3.0f, 0.0f));
+}
+
+TEST_F(SerializationTest, JournalRequiresEndMarkerAndSequence) {
+    World world;
+    const auto e = world.spawn(Transform{}, Name{"a"});
+    for (int i = 0; i < 50; ++i) {
+        world.spawn(Transform{}, Name{"pad" + std::to_string(i)});
+    }
+    
+    const auto path = test_dir / "sequence.yaml";
+    SceneJournal journal(path);
+    ASSERT_TRUE(journal.save(world).has_value());
+    for (const f32 x : {1.0f, 2.0f, 3.0f}) {
+        world.get_component<Transform>(e)->position.x = x;
+        ASSERT_EQ(journal.save(world).value(), JournalWrite::DELTA);
+    }
+    
+    // One string per appended delta ("---\n" + document + "\n")
+    const auto text = read_text(journal.journal_path());
+    std::vector<std::string> deltas;
+    for (std::size_t pos = 0; pos < text.size();) {
+        const auto next = std::min(text.find("---\n", pos + 1), text.size());
+        deltas.push_back(text.substr(pos, next - pos));
+        pos = next;
+    }
+    ASSERT_EQ(deltas.size(), 3u);
+    const auto loaded_x = [&](const std::string& journal_text) {
+        std::ofstream(journal.journal_path(), std::ios::binary | std::ios::trunc) << journal_text;
+        World loaded;
+        EXPECT_TRUE(load_scene_journal(loaded, path).has_value());
+        return loaded.get_component<Transform>(find_named(loaded, "a"))->position.x;
+    };
+    
+    // Torn on a line boundary: still valid YAML, but the end line is missing
+    const auto cut = deltas[2].substr(0, deltas[2].find("removed:"));
+    EXPECT_FLOAT_EQ(loaded_x(deltas[0] + deltas[1] + cut), 2.0f);
+    
+    // Delta 2 lost: delta 3 builds on it, so replay stops after delta 1
+    EXPECT_FLOAT_EQ(loaded_x(deltas[0] + deltas[2]), 1.0f);
+    
+    // A delta retried under the same number: the last copy wins
+    EXPECT_FLOAT_EQ(loaded_x(deltas[0] + deltas[1] + deltas[1] + deltas[2]), 3.0f);
+}